@@ -6,8 +6,10 @@
 #include <barretenberg/common/container.hpp>
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
+#include <barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp>
 #include <barretenberg/srs/global_crs.hpp>
 #include <iostream>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -153,6 +155,52 @@ bool verify(const std::string& proof_path, bool recursive, const std::string& vk
     return verified;
 }
 
+/**
+ * @brief Verifies a batch of proofs for an ACIR circuit against one verification key
+ *
+ * The proofs are checked together with a single combined pairing check. If that fails, the invalid proofs are isolated
+ * and reported.
+ *
+ * Communication:
+ * - proc_exit: A boolean value is returned indicating whether all of the proofs are valid.
+ *   an exit code of 0 will be returned for success and 1 for failure.
+ *
+ * @param proof_paths Comma separated paths to the files containing the serialized proofs
+ * @param recursive Whether to use recursive proof generation of non-recursive
+ * @param vk_path Path to the file containing the serialized verification key
+ * @return true If all of the proofs are valid
+ * @return false If any of the proofs is invalid
+ */
+bool verifyBatch(const std::string& proof_paths, bool recursive, const std::string& vk_path)
+{
+    auto acir_composer = init();
+    auto vk_data = from_buffer<plonk::verification_key_data>(read_file(vk_path));
+    acir_composer.load_verification_key(std::move(vk_data));
+
+    std::vector<std::string> paths;
+    std::stringstream stream(proof_paths);
+    for (std::string path; std::getline(stream, path, ',');) {
+        paths.push_back(path);
+    }
+    std::vector<std::vector<uint8_t>> proofs;
+    for (const auto& path : paths) {
+        proofs.push_back(read_file(path));
+    }
+
+    auto results = acir_composer.verify_proofs(proofs, recursive);
+    bool verified = true;
+    for (size_t i = 0; i < results.size(); ++i) {
+        if (!results[i]) {
+            vinfo("invalid proof: ", paths[i]);
+            verified = false;
+        }
+    }
+
+    vinfo("verified: ", verified);
+
+    return verified;
+}
+
 /**
  * @brief Writes a verification key for an ACIR circuit to a file
  *
@@ -315,6 +363,37 @@ void acvmInfo(const std::string& output_path)
     }
 }
 
+/**
+ * @brief Measures the fastest Pippenger bucket widths for this machine and writes them to a profile file
+ *
+ * Communication:
+ * - Filesystem: The profile is written to the path specified by outputPath. Point the BB_PIPPENGER_PROFILE
+ *   environment variable at it to use it in subsequent runs.
+ *
+ * @param maxNumPoints The largest MSM size to calibrate. Larger MSMs use the widths of this size
+ * @param outputPath Path to write the profile to
+ */
+void calibrate(size_t maxNumPoints, const std::string& outputPath)
+{
+    auto g1_data = get_g1_data(CRS_PATH, maxNumPoints + 1);
+    auto g2_data = get_g2_data(CRS_PATH);
+    srs::init_crs_factory(g1_data, g2_data);
+    auto prover_crs = srs::get_crs_factory()->get_prover_crs(maxNumPoints);
+
+    auto profile = scalar_multiplication::calibrate_bucket_widths<curve::BN254>(prover_crs->get_monomial_points(),
+                                                                                 maxNumPoints);
+    auto profile_str = profile.to_string();
+    vinfo("calibrated pippenger bucket widths:\n", profile_str);
+
+    if (outputPath == "-") {
+        writeStringToStdout(profile_str);
+        vinfo("profile written to stdout");
+    } else {
+        write_file(outputPath, { profile_str.begin(), profile_str.end() });
+        vinfo("profile written to: ", outputPath);
+    }
+}
+
 bool flagPresent(std::vector<std::string>& args, const std::string& flag)
 {
     return std::find(args.begin(), args.end(), flag) != args.end();
@@ -367,6 +446,8 @@ int main(int argc, char* argv[])
             gateCount(bytecode_path);
         } else if (command == "verify") {
             return verify(proof_path, recursive, vk_path) ? 0 : 1;
+        } else if (command == "verify_batch") {
+            return verifyBatch(proof_path, recursive, vk_path) ? 0 : 1;
         } else if (command == "contract") {
             std::string output_path = getOption(args, "-o", "./target/contract.sol");
             contract(output_path, vk_path);
@@ -376,6 +457,10 @@ int main(int argc, char* argv[])
         } else if (command == "proof_as_fields") {
             std::string output_path = getOption(args, "-o", proof_path + "_fields.json");
             proofAsFields(proof_path, vk_path, output_path);
+        } else if (command == "calibrate") {
+            std::string output_path = getOption(args, "-o", "./pippenger_profile");
+            size_t max_num_points = std::stoul(getOption(args, "-n", std::to_string(1 << 20)));
+            calibrate(max_num_points, output_path);
         } else if (command == "vk_as_fields") {
             std::string output_path = getOption(args, "-o", vk_path + "_fields.json");
             vkAsFields(vk_path, output_path);
@@ -1,4 +1,5 @@
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
@@ -76,6 +77,72 @@ int pippenger()
     return 0;
 }
 
+/**
+ * Compare pippenger_unsafe with pippenger_sparse_unsafe on inputs where only a `density` fraction of the scalars are
+ * non-trivial. Half of the remaining scalars are ones and half are zeroes.
+ */
+int pippenger_sparse(const double density)
+{
+    std::vector<fr> sparse_scalars(NUM_POINTS);
+    const auto num_nontrivial = static_cast<size_t>(density * static_cast<double>(NUM_POINTS));
+    const size_t stride = num_nontrivial > 0 ? NUM_POINTS / num_nontrivial : NUM_POINTS + 1;
+    for (size_t i = 0; i < NUM_POINTS; ++i) {
+        if (i % stride == 0) {
+            sparse_scalars[i] = scalars[i];
+        } else {
+            sparse_scalars[i] = (i & 1) ? fr::one() : fr::zero();
+        }
+    }
+
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(NUM_POINTS);
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+    g1::element dense_result = scalar_multiplication::pippenger_unsafe<curve::BN254>(
+        &sparse_scalars[0], reference_string->get_monomial_points(), NUM_POINTS, state);
+    std::chrono::steady_clock::time_point time_mid = std::chrono::steady_clock::now();
+    g1::element sparse_result = scalar_multiplication::pippenger_sparse_unsafe<curve::BN254>(
+        &sparse_scalars[0], reference_string->get_monomial_points(), NUM_POINTS, state);
+    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+
+    std::chrono::microseconds dense_diff =
+        std::chrono::duration_cast<std::chrono::microseconds>(time_mid - time_start);
+    std::chrono::microseconds sparse_diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_mid);
+    std::cout << "density " << density << ": pippenger_unsafe " << dense_diff.count()
+              << "us, pippenger_sparse_unsafe " << sparse_diff.count() << "us" << std::endl;
+    if (dense_result.normalize() != sparse_result.normalize()) {
+        throw_or_abort("pippenger_sparse_unsafe result does not match pippenger_unsafe");
+    }
+    return 0;
+}
+
+/**
+ * Compare the endomorphism + WNAF engine with the signed-digit engine on the same inputs.
+ */
+int pippenger_engines()
+{
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(NUM_POINTS);
+    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+    g1::element wnaf_result = scalar_multiplication::pippenger_unsafe<curve::BN254>(
+        &scalars[0], reference_string->get_monomial_points(), NUM_POINTS, state);
+    std::chrono::steady_clock::time_point time_mid = std::chrono::steady_clock::now();
+    g1::element signed_digit_result =
+        scalar_multiplication::pippenger_unsafe<curve::BN254>(&scalars[0],
+                                                              reference_string->get_monomial_points(),
+                                                              NUM_POINTS,
+                                                              state,
+                                                              scalar_multiplication::msm_engine::signed_digit);
+    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+
+    std::chrono::microseconds wnaf_diff = std::chrono::duration_cast<std::chrono::microseconds>(time_mid - time_start);
+    std::chrono::microseconds signed_digit_diff =
+        std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_mid);
+    std::cout << "endomorphism_wnaf " << wnaf_diff.count() << "us, signed_digit " << signed_digit_diff.count() << "us"
+              << std::endl;
+    if (wnaf_result.normalize() != signed_digit_result.normalize()) {
+        throw_or_abort("signed-digit pippenger result does not match the endomorphism + WNAF engine");
+    }
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -110,5 +177,13 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+    std::cout << "comparing pippenger engines" << std::endl;
+    pippenger_engines();
+    pippenger_engines();
+    pippenger_engines();
+    std::cout << "executing sparse pippenger algorithm" << std::endl;
+    for (const double density : { 1.0, 0.5, 0.25, 0.1, 0.01 }) {
+        pippenger_sparse(density);
+    }
     return 0;
 }
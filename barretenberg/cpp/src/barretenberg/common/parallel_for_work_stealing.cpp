@@ -0,0 +1,266 @@
+#include "log.hpp"
+#include "thread.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * A single parallel_for invocation. Lives on the stack of the calling thread for the duration of the call.
+ * `remaining` counts iterations not yet completed, and hits zero exactly once. Ranges of at most `grain_size`
+ * iterations are run without being split further.
+ */
+struct Job {
+    const std::function<void(size_t)>* func;
+    std::atomic<size_t> remaining;
+    size_t grain_size;
+};
+
+/**
+ * A contiguous range of iterations [begin, end) belonging to a job. Ranges are split lazily: whoever executes a range
+ * pushes its upper half back onto their own queue (where it can be stolen) and carries on with the lower half.
+ */
+struct Task {
+    Job* job;
+    size_t begin;
+    size_t end;
+};
+
+/**
+ * Per-thread double ended queue. The owner pushes and pops at the back (LIFO, cache friendly), thieves take from the
+ * front (FIFO, which tends to be the largest unsplit ranges).
+ * Aligned to avoid false sharing of the mutexes between neighbouring queues.
+ */
+struct alignas(64) WorkerQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+
+    void push(const Task& task)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        tasks.push_back(task);
+    }
+
+    bool pop(Task& task)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (tasks.empty()) {
+            return false;
+        }
+        task = tasks.back();
+        tasks.pop_back();
+        return true;
+    }
+
+    bool steal(Task& task)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (tasks.empty()) {
+            return false;
+        }
+        task = tasks.front();
+        tasks.pop_front();
+        return true;
+    }
+};
+
+// Index of the queue owned by the current thread. Threads that are not pool workers (e.g. the main thread) all share
+// the last queue.
+thread_local size_t thread_queue_index = SIZE_MAX;
+
+class WorkStealingPool {
+  public:
+    WorkStealingPool(size_t num_threads);
+    WorkStealingPool(const WorkStealingPool& other) = delete;
+    WorkStealingPool(WorkStealingPool&& other) = delete;
+    ~WorkStealingPool();
+
+    WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+    WorkStealingPool& operator=(WorkStealingPool&& other) = delete;
+
+    void run(size_t num_iterations, const std::function<void(size_t)>& func)
+    {
+        // Split into about 4 ranges per thread: enough for stealing to even out the load, without paying a push (and
+        // possibly a wake up) for every single iteration.
+        const size_t grain_size = std::max<size_t>(1, num_iterations / (4 * queues.size()));
+        Job job{ &func, num_iterations, grain_size };
+        // Seed the range on our own queue so idle threads can immediately steal the upper half, then help out until
+        // every iteration of this job has been completed (possibly by others).
+        execute({ &job, 0, num_iterations });
+        wait_for(job);
+    }
+
+  private:
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::atomic<size_t> pending_tasks = 0;
+    // Threads waiting on the condition, so that pushes only take sleep_mutex when there is somebody to wake up.
+    std::atomic<size_t> num_sleepers = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable condition;
+    std::atomic<bool> stop = false;
+
+    void worker_loop(size_t thread_index);
+
+    WorkerQueue& local_queue() { return *queues[std::min(thread_queue_index, queues.size() - 1)]; }
+
+    /**
+     * Sleep until `predicate` holds. The predicate must read the atomics that wake_one/wake_all callers update before
+     * waking, with sequentially consistent loads: a sleeper registers itself in num_sleepers before checking the
+     * predicate, and a waker updates its atomic before checking num_sleepers, so at least one of them sees the other.
+     */
+    template <typename Predicate> void sleep_until(Predicate predicate)
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        num_sleepers.fetch_add(1);
+        condition.wait(lock, predicate);
+        num_sleepers.fetch_sub(1);
+    }
+
+    void wake_one()
+    {
+        if (num_sleepers.load() == 0) {
+            return;
+        }
+        // Cycle the lock so a sleeper is either already waiting, or yet to check its predicate (and sees the update).
+        {
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+        }
+        condition.notify_one();
+    }
+
+    void wake_all()
+    {
+        if (num_sleepers.load() == 0) {
+            return;
+        }
+        // Take the lock so a waiter cannot miss the notification between checking its predicate and sleeping.
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        condition.notify_all();
+    }
+
+    void push(const Task& task)
+    {
+        local_queue().push(task);
+        pending_tasks.fetch_add(1);
+        wake_one();
+    }
+
+    bool find_task(Task& task)
+    {
+        if (local_queue().pop(task)) {
+            pending_tasks.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+        // Start stealing from our neighbour, to spread thieves over the victims.
+        const size_t num_queues = queues.size();
+        const size_t start = std::min(thread_queue_index, num_queues - 1) + 1;
+        for (size_t i = 0; i < num_queues; ++i) {
+            if (queues[(start + i) % num_queues]->steal(task)) {
+                pending_tasks.fetch_sub(1, std::memory_order_acq_rel);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void execute(Task task)
+    {
+        // Binary split down to the grain size, publishing the upper halves for thieves.
+        while (task.end - task.begin > task.job->grain_size) {
+            size_t mid = task.begin + (task.end - task.begin) / 2;
+            push({ task.job, mid, task.end });
+            task.end = mid;
+        }
+        for (size_t i = task.begin; i < task.end; ++i) {
+            (*task.job->func)(i);
+        }
+        const size_t num_executed = task.end - task.begin;
+        if (task.job->remaining.fetch_sub(num_executed) == num_executed) {
+            wake_all();
+        }
+    }
+
+    /**
+     * Rather than blocking, a thread waiting on a job keeps executing whatever work it can find. This is what makes
+     * nested parallel_for calls safe: the inner call's waiter can never starve the outer call of threads.
+     */
+    void wait_for(Job& job)
+    {
+        Task task{};
+        while (job.remaining.load(std::memory_order_acquire) != 0) {
+            if (find_task(task)) {
+                execute(task);
+                continue;
+            }
+            sleep_until([&] { return job.remaining.load() == 0 || pending_tasks.load() != 0; });
+        }
+    }
+};
+
+WorkStealingPool::WorkStealingPool(size_t num_threads)
+{
+    // One queue per worker, plus one shared by all external threads.
+    queues.reserve(num_threads + 1);
+    for (size_t i = 0; i < num_threads + 1; ++i) {
+        queues.emplace_back(std::make_unique<WorkerQueue>());
+    }
+    workers.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers.emplace_back(&WorkStealingPool::worker_loop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::worker_loop(size_t thread_index)
+{
+    thread_queue_index = thread_index;
+    Task task{};
+    while (true) {
+        if (find_task(task)) {
+            execute(task);
+            continue;
+        }
+        sleep_until([this] { return pending_tasks.load() != 0 || stop.load(); });
+        if (stop.load()) {
+            break;
+        }
+    }
+}
+} // namespace
+
+/**
+ * A persistent pool of workers, each owning a deque of iteration ranges, that steal from each other when idle.
+ * A thread that calls parallel_for splits the range in half down to about 4 ranges per thread, publishing the halves,
+ * and then helps with any outstanding work until its own job completes. Because waiting threads keep working,
+ * parallel_for can be called from inside a parallel_for body (e.g. an FFT inside a sumcheck round, or concurrent
+ * Pippenger calls) without oversubscribing the machine or deadlocking: all nested loops share the same
+ * get_num_cpus() threads.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    static WorkStealingPool pool(get_num_cpus() - 1);
+
+    if (num_iterations == 0) {
+        return;
+    }
+    pool.run(num_iterations, func);
+}
@@ -463,6 +463,9 @@ using out_buf128 = uint8_t*;
 using in_str_buf = uint8_t const*;
 using out_str_buf = uint8_t**;
 
+// Variable length vectors of variable length buffers. Prefixed with the number of buffers, each prefixed with length.
+using in_buf_vec = uint8_t const*;
+
 // Use these to pass a raw memory pointer.
 using in_ptr = void* const*;
 using out_ptr = void**;
@@ -34,6 +34,11 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: All of the above are flat fork-join loops around a single shared task, so a parallel_for issued from inside
+ * a parallel_for body either serialises or corrupts the outer loop. "work_stealing" keeps a persistent pool where each
+ * thread owns a deque of iteration ranges and idle threads steal. Waiting threads keep executing work, so nested calls
+ * (e.g. an MSM running alongside FFTs) share the same cores rather than oversubscribing them. Defaulting to it.
  */
 
 // 64 core aws r5.
@@ -68,6 +73,8 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -81,7 +88,8 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
 #endif
 #endif
@@ -1,9 +1,12 @@
 #pragma once
+#include <algorithm>
 #include <atomic>
 #include <barretenberg/env/hardware_concurrency.hpp>
 #include <barretenberg/numeric/bitop/get_msb.hpp>
 #include <functional>
 #include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 inline size_t get_num_cpus()
@@ -21,4 +24,132 @@ inline size_t get_num_cpus_pow2()
     return static_cast<size_t>(1ULL << numeric::get_msb(get_num_cpus()));
 }
 
-void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
\ No newline at end of file
+void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+
+/**
+ * @brief Bounds of chunk `chunk_index` when [begin, end) is split into `num_chunks` contiguous, near-equal chunks.
+ */
+inline std::pair<size_t, size_t> get_range_chunk(size_t begin, size_t end, size_t num_chunks, size_t chunk_index)
+{
+    const size_t size = end - begin;
+    const size_t chunk_size = size / num_chunks;
+    const size_t leftovers = size % num_chunks;
+    // The first `leftovers` chunks take one extra iteration each.
+    const size_t start = begin + chunk_index * chunk_size + std::min(chunk_index, leftovers);
+    return { start, start + chunk_size + (chunk_index < leftovers ? 1 : 0) };
+}
+
+/**
+ * @brief Number of chunks to split [begin, end) into: one per cpu, unless that leaves fewer than `grain_size`
+ * iterations in a chunk.
+ */
+inline size_t get_num_range_chunks(size_t begin, size_t end, size_t grain_size)
+{
+    const size_t size = end > begin ? end - begin : 0;
+    grain_size = grain_size > 0 ? grain_size : 1;
+    if (size == 0) {
+        return 0;
+    }
+    const size_t max_chunks = std::max<size_t>(size / grain_size, 1);
+    return std::min(max_chunks, get_num_cpus());
+}
+
+/**
+ * @brief Run `func` over [begin, end), divided into one contiguous chunk per thread (fewer if a chunk would hold less
+ * than `grain_size` iterations).
+ *
+ * @details `func` is either called as `func(chunk_start, chunk_end)` once per chunk, which suits bodies with per-chunk
+ * setup (e.g. an initial power of a challenge), or as `func(i)` for every index. In both cases the body is inlined into
+ * the chunk loop, so only one type-erased call is made per chunk rather than per iteration.
+ */
+template <typename Func> void parallel_for_range(size_t begin, size_t end, size_t grain_size, Func&& func)
+{
+    const size_t num_chunks = get_num_range_chunks(begin, end, grain_size);
+    if (num_chunks == 0) {
+        return;
+    }
+    auto run_chunk = [&](size_t chunk_index) {
+        auto [start, stop] = get_range_chunk(begin, end, num_chunks, chunk_index);
+        if constexpr (std::is_invocable_v<Func, size_t, size_t>) {
+            func(start, stop);
+        } else {
+            for (size_t i = start; i < stop; ++i) {
+                func(i);
+            }
+        }
+    };
+    if (num_chunks == 1) {
+        run_chunk(0);
+        return;
+    }
+    parallel_for(num_chunks, run_chunk);
+}
+
+/**
+ * @brief Map-reduce over [begin, end), chunked as in parallel_for_range.
+ *
+ * @details `func(chunk_start, chunk_end)` returns the partial result of one chunk. The partial results are folded
+ * into `identity` with `reduce(accumulator, partial)` in chunk order, so the result does not depend on scheduling.
+ */
+template <typename T, typename Func, typename Reduce>
+T parallel_reduce(size_t begin, size_t end, size_t grain_size, T identity, Func&& func, Reduce&& reduce)
+{
+    const size_t num_chunks = get_num_range_chunks(begin, end, grain_size);
+    if (num_chunks == 0) {
+        return identity;
+    }
+    if (num_chunks == 1) {
+        return reduce(std::move(identity), func(begin, end));
+    }
+    std::vector<T> partials(num_chunks, identity);
+    parallel_for(num_chunks, [&](size_t chunk_index) {
+        auto [start, stop] = get_range_chunk(begin, end, num_chunks, chunk_index);
+        partials[chunk_index] = func(start, stop);
+    });
+    T result = std::move(identity);
+    for (auto& partial : partials) {
+        result = reduce(std::move(result), std::move(partial));
+    }
+    return result;
+}
+
+/**
+ * @brief Map-reduce over [begin, end) for bodies whose cost varies across the range, so that an even split would
+ * leave threads idle.
+ *
+ * @details The range is cut into chunks of `chunk_size` iterations, which the workers claim one at a time as they
+ * finish the previous one. Each worker folds its chunks into its own accumulator with
+ * `func(accumulator, chunk_start, chunk_end)`, and the accumulators are then combined with
+ * `reduce(accumulator, partial)`. Which chunks a worker claims depends on scheduling, so `reduce` (and the folding
+ * done by `func`) must be associative and commutative for the result to be deterministic.
+ */
+template <typename T, typename Func, typename Reduce>
+T parallel_reduce_dynamic(size_t begin, size_t end, size_t chunk_size, T identity, Func&& func, Reduce&& reduce)
+{
+    const size_t size = end > begin ? end - begin : 0;
+    chunk_size = chunk_size > 0 ? chunk_size : 1;
+    const size_t num_chunks = (size + chunk_size - 1) / chunk_size;
+    const size_t num_workers = std::min(num_chunks, get_num_cpus());
+    if (num_workers == 0) {
+        return identity;
+    }
+    if (num_workers == 1) {
+        T accumulator = identity;
+        func(accumulator, begin, end);
+        return reduce(std::move(identity), std::move(accumulator));
+    }
+    std::atomic<size_t> next_chunk = 0;
+    std::vector<T> partials(num_workers, identity);
+    parallel_for(num_workers, [&](size_t worker_index) {
+        for (size_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed); chunk < num_chunks;
+             chunk = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+            const size_t start = begin + chunk * chunk_size;
+            func(partials[worker_index], start, std::min(start + chunk_size, end));
+        }
+    });
+    T result = std::move(identity);
+    for (auto& partial : partials) {
+        result = reduce(std::move(result), std::move(partial));
+    }
+    return result;
+}
@@ -0,0 +1,143 @@
+#include "thread.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(thread, ParallelForVisitsEachIterationOnce)
+{
+    constexpr size_t num_iterations = 1000;
+    std::vector<std::atomic<size_t>> counts(num_iterations);
+
+    parallel_for(num_iterations, [&](size_t i) { counts[i]++; });
+
+    for (auto& count : counts) {
+        EXPECT_EQ(count.load(), 1UL);
+    }
+}
+
+TEST(thread, ParallelForZeroIterations)
+{
+    bool called = false;
+    parallel_for(0, [&](size_t) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+TEST(thread, NestedParallelFor)
+{
+    constexpr size_t outer = 16;
+    constexpr size_t inner = 64;
+    std::vector<std::atomic<size_t>> counts(outer * inner);
+
+    parallel_for(outer, [&](size_t i) { parallel_for(inner, [&](size_t j) { counts[i * inner + j]++; }); });
+
+    for (auto& count : counts) {
+        EXPECT_EQ(count.load(), 1UL);
+    }
+}
+
+TEST(thread, ConcurrentCallersShareThePool)
+{
+    constexpr size_t num_callers = 4;
+    constexpr size_t num_iterations = 256;
+    std::atomic<size_t> total = 0;
+
+    std::vector<std::thread> callers;
+    for (size_t i = 0; i < num_callers; ++i) {
+        callers.emplace_back([&] { parallel_for(num_iterations, [&](size_t) { total++; }); });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+
+    EXPECT_EQ(total.load(), num_callers * num_iterations);
+}
+
+TEST(thread, ParallelForRangeCoversRange)
+{
+    constexpr size_t begin = 3;
+    constexpr size_t end = 1003;
+    std::vector<std::atomic<size_t>> counts(end);
+
+    parallel_for_range(begin, end, 7, [&](size_t i) { counts[i]++; });
+
+    for (size_t i = 0; i < end; ++i) {
+        EXPECT_EQ(counts[i].load(), i < begin ? 0UL : 1UL);
+    }
+}
+
+TEST(thread, ParallelForRangeChunks)
+{
+    constexpr size_t num_iterations = 1000;
+    constexpr size_t grain_size = 300;
+    std::atomic<size_t> total = 0;
+    std::atomic<size_t> num_chunks = 0;
+
+    parallel_for_range(0, num_iterations, grain_size, [&](size_t start, size_t end) {
+        EXPECT_GE(end - start, grain_size);
+        total += end - start;
+        num_chunks++;
+    });
+
+    EXPECT_EQ(total.load(), num_iterations);
+    EXPECT_LE(num_chunks.load(), num_iterations / grain_size);
+}
+
+TEST(thread, ParallelReduce)
+{
+    constexpr size_t num_iterations = 100000;
+    auto sum = parallel_reduce(
+        0,
+        num_iterations,
+        16,
+        size_t(0),
+        [](size_t start, size_t end) {
+            size_t partial = 0;
+            for (size_t i = start; i < end; ++i) {
+                partial += i;
+            }
+            return partial;
+        },
+        [](size_t acc, size_t partial) { return acc + partial; });
+
+    EXPECT_EQ(sum, num_iterations * (num_iterations - 1) / 2);
+}
+
+TEST(thread, ParallelReduceEmptyRange)
+{
+    auto result = parallel_reduce(
+        5, 5, 1, size_t(42), [](size_t, size_t) { return size_t(1); }, [](size_t a, size_t b) { return a + b; });
+    EXPECT_EQ(result, 42UL);
+}
+
+TEST(thread, ParallelReduceDynamicUnevenWork)
+{
+    constexpr size_t num_iterations = 10000;
+    std::atomic<size_t> num_calls = 0;
+    // The cost of an iteration grows with its index, so an even split would leave the early threads idle
+    auto sum = parallel_reduce_dynamic(
+        0,
+        num_iterations,
+        64,
+        size_t(0),
+        [&](size_t& acc, size_t start, size_t end) {
+            num_calls++;
+            for (size_t i = start; i < end; ++i) {
+                volatile size_t spin = 0;
+                for (size_t j = 0; j < i; ++j) {
+                    spin = spin + 1;
+                }
+                acc += i;
+            }
+        },
+        [](size_t acc, size_t partial) { return acc + partial; });
+
+    EXPECT_EQ(sum, num_iterations * (num_iterations - 1) / 2);
+    EXPECT_LE(num_calls.load(), (num_iterations + 63) / 64);
+}
+
+TEST(thread, ParallelReduceDynamicEmptyRange)
+{
+    auto result = parallel_reduce_dynamic(
+        5, 5, 1, size_t(42), [](size_t& acc, size_t, size_t) { acc++; }, [](size_t a, size_t b) { return a + b; });
+    EXPECT_EQ(result, 42UL);
+}
@@ -0,0 +1,47 @@
+#include "keccak.hpp"
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace benchmark;
+
+namespace {
+constexpr size_t NUM_MESSAGES = 1 << 12;
+
+std::vector<uint8_t> generate_messages(size_t message_size)
+{
+    std::vector<uint8_t> data(NUM_MESSAGES * message_size);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 31);
+    }
+    return data;
+}
+} // namespace
+
+void keccak256_single_bench(State& state) noexcept
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    auto data = generate_messages(size);
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_MESSAGES; ++i) {
+            DoNotOptimize(ethash_keccak256(data.data() + i * size, size));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_MESSAGES));
+}
+BENCHMARK(keccak256_single_bench)->Arg(64)->Arg(1024)->Unit(kMicrosecond);
+
+void keccak256_batch_bench(State& state) noexcept
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    auto data = generate_messages(size);
+    std::vector<keccak256> out(NUM_MESSAGES);
+    for (auto _ : state) {
+        ethash_keccak256_batch(out.data(), data.data(), size, NUM_MESSAGES);
+        DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_MESSAGES));
+}
+BENCHMARK(keccak256_batch_bench)->Arg(64)->Arg(1024)->Unit(kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -7,6 +7,8 @@
 
 #include "./hash_types.hpp"
 
+#include <vector>
+
 #if _MSC_VER
 #include <string.h>
 #define __builtin_memcpy memcpy
@@ -105,24 +107,80 @@ struct keccak256 ethash_keccak256(const uint8_t* data, size_t size) NOEXCEPT
     return hash;
 }
 
-struct keccak256 hash_field_elements(const uint64_t* limbs, size_t num_elements)
+/** Absorbs eight messages of `size` bytes each, stored back to back in `data`, into eight interleaved states. */
+static inline void keccak256_x8(struct keccak256* out, const uint8_t* data, size_t size)
 {
-    uint8_t input_buffer[num_elements * 32];
+    static const size_t word_size = sizeof(uint64_t);
+    static const size_t lanes = 8;
+    const size_t block_size = (1600 - 256 * 2) / 8;
 
+    size_t i;
+    size_t lane;
+    size_t offset = 0;
+    uint64_t states[8][25] = { { 0 } };
+
+    for (; offset + block_size <= size; offset += block_size) {
+        for (lane = 0; lane < lanes; ++lane) {
+            for (i = 0; i < (block_size / word_size); ++i) {
+                states[lane][i] ^= load_le(data + lane * size + offset + i * word_size);
+            }
+        }
+        ethash_keccakf1600_x8(states);
+    }
+
+    for (lane = 0; lane < lanes; ++lane) {
+        uint8_t last_block[(1600 - 256 * 2) / 8] = { 0 };
+        __builtin_memcpy(last_block, data + lane * size + offset, size - offset);
+        last_block[size - offset] = 0x01;
+        last_block[block_size - 1] |= 0x80;
+        for (i = 0; i < (block_size / word_size); ++i) {
+            states[lane][i] ^= load_le(last_block + i * word_size);
+        }
+    }
+    ethash_keccakf1600_x8(states);
+
+    for (lane = 0; lane < lanes; ++lane) {
+        for (i = 0; i < 4; ++i) {
+            out[lane].word64s[i] = to_le64(states[lane][i]);
+        }
+    }
+}
+
+void ethash_keccak256_batch(struct keccak256* out, const uint8_t* data, size_t size, size_t num_messages) NOEXCEPT
+{
+    size_t message = 0;
+    for (; message + 8 <= num_messages; message += 8) {
+        keccak256_x8(out + message, data + message * size, size);
+    }
+    for (; message < num_messages; ++message) {
+        out[message] = ethash_keccak256(data + message * size, size);
+    }
+}
+
+/** Serializes field elements as 32-byte big-endian words, the layout hashed by hash_field_elements. */
+static inline void write_field_elements(uint8_t* out, const uint64_t* limbs, size_t num_elements)
+{
     for (size_t i = 0; i < num_elements; ++i) {
         for (size_t j = 0; j < 4; ++j) {
             uint64_t word = (limbs[i * 4 + j]);
             size_t idx = i * 32 + j * 8;
-            input_buffer[idx] = (uint8_t)((word >> 56) & 0xff);
-            input_buffer[idx + 1] = (uint8_t)((word >> 48) & 0xff);
-            input_buffer[idx + 2] = (uint8_t)((word >> 40) & 0xff);
-            input_buffer[idx + 3] = (uint8_t)((word >> 32) & 0xff);
-            input_buffer[idx + 4] = (uint8_t)((word >> 24) & 0xff);
-            input_buffer[idx + 5] = (uint8_t)((word >> 16) & 0xff);
-            input_buffer[idx + 6] = (uint8_t)((word >> 8) & 0xff);
-            input_buffer[idx + 7] = (uint8_t)(word & 0xff);
+            out[idx] = (uint8_t)((word >> 56) & 0xff);
+            out[idx + 1] = (uint8_t)((word >> 48) & 0xff);
+            out[idx + 2] = (uint8_t)((word >> 40) & 0xff);
+            out[idx + 3] = (uint8_t)((word >> 32) & 0xff);
+            out[idx + 4] = (uint8_t)((word >> 24) & 0xff);
+            out[idx + 5] = (uint8_t)((word >> 16) & 0xff);
+            out[idx + 6] = (uint8_t)((word >> 8) & 0xff);
+            out[idx + 7] = (uint8_t)(word & 0xff);
         }
     }
+}
+
+struct keccak256 hash_field_elements(const uint64_t* limbs, size_t num_elements)
+{
+    uint8_t input_buffer[num_elements * 32];
+
+    write_field_elements(input_buffer, limbs, num_elements);
 
     return ethash_keccak256(input_buffer, num_elements * 32);
 }
@@ -131,3 +189,12 @@ struct keccak256 hash_field_element(const uint64_t* limb)
 {
     return hash_field_elements(limb, 1);
 }
+
+void hash_field_elements_batch(struct keccak256* out, const uint64_t* limbs, size_t num_elements, size_t num_hashes)
+{
+    std::vector<uint8_t> input_buffer(num_hashes * num_elements * 32);
+
+    write_field_elements(input_buffer.data(), limbs, num_hashes * num_elements);
+
+    ethash_keccak256_batch(out, input_buffer.data(), num_elements * 32, num_hashes);
+}
@@ -29,12 +29,36 @@ extern "C" {
  */
 void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT;
 
+/**
+ * The Keccak-f[1600] function applied to 2, 4 or 8 independent states at once.
+ *
+ * The states are interleaved into SIMD lanes (SSE2, AVX2 or AVX-512, chosen at runtime). Where the instruction set is
+ * not available the call falls back to the narrower variants, and ultimately to ethash_keccakf1600.
+ *
+ * @param states  The states on which the permutation is to be performed.
+ */
+void ethash_keccakf1600_x2(uint64_t states[2][25]) NOEXCEPT;
+void ethash_keccakf1600_x4(uint64_t states[4][25]) NOEXCEPT;
+void ethash_keccakf1600_x8(uint64_t states[8][25]) NOEXCEPT;
+
 struct keccak256 ethash_keccak256(const uint8_t* data, size_t size) NOEXCEPT;
 
+/**
+ * Keccak-256 of `num_messages` messages of `size` bytes each, stored back to back in `data`.
+ *
+ * Messages are absorbed eight at a time using ethash_keccakf1600_x8.
+ */
+void ethash_keccak256_batch(struct keccak256* out, const uint8_t* data, size_t size, size_t num_messages) NOEXCEPT;
+
 struct keccak256 hash_field_elements(const uint64_t* limbs, size_t num_elements);
 
 struct keccak256 hash_field_element(const uint64_t* limb);
 
+/**
+ * hash_field_elements applied to `num_hashes` consecutive groups of `num_elements` field elements each.
+ */
+void hash_field_elements_batch(struct keccak256* out, const uint64_t* limbs, size_t num_elements, size_t num_hashes);
+
 #ifdef __cplusplus
 }
 #endif
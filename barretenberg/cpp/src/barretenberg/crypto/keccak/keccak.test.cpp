@@ -0,0 +1,74 @@
+#include "keccak.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+std::mt19937_64 engine(1);
+}
+
+TEST(keccak, permutation_x8_matches_single)
+{
+    uint64_t states[8][25];
+    uint64_t expected[8][25];
+    for (size_t i = 0; i < 8; ++i) {
+        for (size_t j = 0; j < 25; ++j) {
+            states[i][j] = engine();
+        }
+    }
+    std::memcpy(expected, states, sizeof(states));
+    for (auto& state : expected) {
+        ethash_keccakf1600(state);
+    }
+
+    uint64_t result[8][25];
+    std::memcpy(result, states, sizeof(states));
+    ethash_keccakf1600_x2(result);
+    EXPECT_EQ(std::memcmp(result, expected, 2 * sizeof(states[0])), 0);
+
+    std::memcpy(result, states, sizeof(states));
+    ethash_keccakf1600_x4(result);
+    EXPECT_EQ(std::memcmp(result, expected, 4 * sizeof(states[0])), 0);
+
+    std::memcpy(result, states, sizeof(states));
+    ethash_keccakf1600_x8(result);
+    EXPECT_EQ(std::memcmp(result, expected, sizeof(states)), 0);
+}
+
+TEST(keccak, batch_matches_single)
+{
+    // Sizes around the 136-byte rate exercise the padding of a full and an empty final block. 19 messages leave a
+    // tail that is not a multiple of the batch width.
+    constexpr size_t num_messages = 19;
+    for (const size_t size : { 0UL, 1UL, 31UL, 32UL, 135UL, 136UL, 137UL, 300UL }) {
+        std::vector<uint8_t> data(num_messages * size);
+        for (auto& byte : data) {
+            byte = static_cast<uint8_t>(engine());
+        }
+        std::vector<keccak256> result(num_messages);
+        ethash_keccak256_batch(result.data(), data.data(), size, num_messages);
+        for (size_t i = 0; i < num_messages; ++i) {
+            const keccak256 expected = ethash_keccak256(data.data() + i * size, size);
+            EXPECT_EQ(std::memcmp(&result[i], &expected, sizeof(keccak256)), 0) << "size " << size << ", message " << i;
+        }
+    }
+}
+
+TEST(keccak, hash_field_elements_batch_matches_single)
+{
+    constexpr size_t num_elements = 8;
+    constexpr size_t num_hashes = 21;
+    std::vector<uint64_t> limbs(num_hashes * num_elements * 4);
+    for (auto& limb : limbs) {
+        limb = engine();
+    }
+    std::vector<keccak256> result(num_hashes);
+    hash_field_elements_batch(result.data(), limbs.data(), num_elements, num_hashes);
+    for (size_t i = 0; i < num_hashes; ++i) {
+        const keccak256 expected = hash_field_elements(limbs.data() + i * num_elements * 4, num_elements);
+        EXPECT_EQ(std::memcmp(&result[i], &expected, sizeof(keccak256)), 0);
+    }
+}
@@ -0,0 +1,140 @@
+#include "keccak.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+constexpr uint64_t round_constants[24] = {
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000, 0x000000000000808b,
+    0x0000000080000001, 0x8000000080008081, 0x8000000000008009, 0x000000000000008a, 0x0000000000000088,
+    0x0000000080008009, 0x000000008000000a, 0x000000008000808b, 0x800000000000008b, 0x8000000000008089,
+    0x8000000000008003, 0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+};
+
+// Rotation offsets of the rho step, indexed by x + 5y
+constexpr uint64_t rho_offsets[25] = { 0,  1,  62, 28, 27, 36, 44, 6,  55, 20, 3,  10, 43,
+                                       25, 39, 41, 45, 15, 21, 8,  18, 2,  61, 56, 14 };
+
+// Destination of each word under the pi step: (x, y) moves to (y, 2x + 3y)
+constexpr size_t pi_destinations[25] = { 0,  10, 20, 5,  15, 16, 1,  11, 21, 6, 7,  17, 2,
+                                         12, 22, 23, 8,  18, 3,  13, 14, 24, 9, 19, 4 };
+
+#if defined(__x86_64__)
+
+using u64x2 = uint64_t __attribute__((vector_size(16)));
+using u64x4 = uint64_t __attribute__((vector_size(32)));
+using u64x8 = uint64_t __attribute__((vector_size(64)));
+
+/**
+ * @brief Keccak-f[1600] on one interleaved state per lane of `Vec`
+ * @details Word i of every state lives in `A[i]`, so each step of a round is a handful of vector instructions
+ * covering all lanes. Vectors are only passed by pointer, and the function is always inlined into a kernel compiled
+ * for the matching instruction set.
+ */
+template <typename Vec> [[gnu::always_inline]] inline void keccakf1600_lanes(Vec* A)
+{
+    for (size_t round = 0; round < 24; ++round) {
+        // theta
+        Vec C[5];
+        for (size_t x = 0; x < 5; ++x) {
+            C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+        }
+        for (size_t x = 0; x < 5; ++x) {
+            const Vec& rotated = C[(x + 1) % 5];
+            const Vec D = C[(x + 4) % 5] ^ ((rotated << 1) | (rotated >> 63));
+            for (size_t y = 0; y < 25; y += 5) {
+                A[x + y] ^= D;
+            }
+        }
+
+        // rho and pi. Unrolled so that every rotation is by a constant and maps to a single vector rotate
+        Vec B[25];
+        B[0] = A[0];
+#pragma GCC unroll 24
+        for (size_t i = 1; i < 25; ++i) {
+            B[pi_destinations[i]] = (A[i] << rho_offsets[i]) | (A[i] >> (64 - rho_offsets[i]));
+        }
+
+        // chi
+        for (size_t y = 0; y < 25; y += 5) {
+            for (size_t x = 0; x < 5; ++x) {
+                A[x + y] = B[x + y] ^ (~B[(x + 1) % 5 + y] & B[(x + 2) % 5 + y]);
+            }
+        }
+
+        // iota
+        A[0] ^= round_constants[round];
+    }
+}
+
+template <typename Vec, size_t LANES> [[gnu::always_inline]] inline void keccakf1600_interleaved(uint64_t (*states)[25])
+{
+    Vec A[25];
+    for (size_t i = 0; i < 25; ++i) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            A[i][lane] = states[lane][i];
+        }
+    }
+    keccakf1600_lanes(A);
+    for (size_t i = 0; i < 25; ++i) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            states[lane][i] = A[i][lane];
+        }
+    }
+}
+
+__attribute__((target("sse2"))) void keccakf1600_sse2(uint64_t (*states)[25])
+{
+    keccakf1600_interleaved<u64x2, 2>(states);
+}
+
+__attribute__((target("avx2"))) void keccakf1600_avx2(uint64_t (*states)[25])
+{
+    keccakf1600_interleaved<u64x4, 4>(states);
+}
+
+__attribute__((target("avx512f"))) void keccakf1600_avx512(uint64_t (*states)[25])
+{
+    keccakf1600_interleaved<u64x8, 8>(states);
+}
+
+#endif
+
+} // namespace
+
+void ethash_keccakf1600_x2(uint64_t states[2][25]) NOEXCEPT
+{
+#if defined(__x86_64__)
+    keccakf1600_sse2(states);
+#else
+    ethash_keccakf1600(states[0]);
+    ethash_keccakf1600(states[1]);
+#endif
+}
+
+void ethash_keccakf1600_x4(uint64_t states[4][25]) NOEXCEPT
+{
+#if defined(__x86_64__)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2) {
+        keccakf1600_avx2(states);
+        return;
+    }
+#endif
+    ethash_keccakf1600_x2(states);
+    ethash_keccakf1600_x2(states + 2);
+}
+
+void ethash_keccakf1600_x8(uint64_t states[8][25]) NOEXCEPT
+{
+#if defined(__x86_64__)
+    static const bool has_avx512 = __builtin_cpu_supports("avx512f");
+    if (has_avx512) {
+        keccakf1600_avx512(states);
+        return;
+    }
+#endif
+    ethash_keccakf1600_x4(states);
+    ethash_keccakf1600_x4(states + 4);
+}
@@ -2,8 +2,14 @@
 
 #include "./pedersen.hpp"
 #include "./convert_buffer_to_field.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
 #ifndef NO_OMP_MULTITHREADING
 #include <omp.h>
 #endif
@@ -119,5 +125,183 @@ grumpkin::fq compress_native(const std::vector<uint8_t>& input, const size_t has
     return compress_native_buffer_to_field(input, hash_index);
 }
 
+namespace {
+// commit_single computes a 254-bit scalar multiplication as 128 ladder points, one per 2-bit window plus the
+// start of the ladder. The batched commitment reads pairs of adjacent windows from a table instead.
+constexpr size_t NUM_HASH_BITS = 254;
+constexpr size_t NUM_HASH_QUADS = 127;
+constexpr size_t NUM_WINDOW_PAIRS = (NUM_HASH_QUADS + 1) / 2;
+// The first pair is the (fixed) start of the ladder and the first window, together with the skew correction.
+constexpr size_t FIRST_PAIR_TABLE_SIZE = 8;
+constexpr size_t PAIR_TABLE_SIZE = 16;
+constexpr size_t WINDOW_PAIR_TABLE_SIZE = FIRST_PAIR_TABLE_SIZE + (NUM_WINDOW_PAIRS - 1) * PAIR_TABLE_SIZE;
+// Commitments summed together share each batch inversion.
+constexpr size_t POINTS_PER_BLOCK = 4096;
+
+using window_pair_table = std::vector<grumpkin::g1::affine_element>;
+
+#if !defined(__wasm__)
+std::mutex window_pair_tables_mutex;
+#endif
+
+/**
+ * @brief Encode a wnaf entry of commit_single as the index of the ladder point it selects: bit 0 chooses `three` over
+ * `one`, bit 1 negates it
+ */
+inline size_t get_window_code(const uint64_t wnaf_entry)
+{
+    return (((wnaf_entry & WNAF_MASK) == 1) ? 1UL : 0UL) | (((wnaf_entry >> 31U) & 1U) << 1);
+}
+
+grumpkin::g1::element get_window_point(const fixed_base_ladder& ladder, const size_t code)
+{
+    grumpkin::g1::element point((code & 1) ? ladder.three : ladder.one);
+    return (code & 2) ? -point : point;
+}
+
+/**
+ * @brief The sums of the ladder points of commit_single over each pair of adjacent windows, for the generator at
+ * `index`
+ *
+ * @details The entry for windows (2j, 2j + 1) and codes (a, b) is at 8 + 16 * (j - 1) + 4a + b. The first pair holds
+ * the start of the ladder plus window 1 with code a, minus the skew generator if s is set, at 4s + a. A table holds
+ * 1016 points (64kb); tables are built for the generator indices passed to commit_native_batch and kept for later
+ * calls. They are keyed by the generator itself, and get_generator_data rejects indices outside of the fixed generator
+ * set, so there is at most one table per precomputed generator: 776 tables (about 50mb) if every generator is used.
+ */
+const window_pair_table& get_window_pair_table(generator_index_t const& index)
+{
+    static std::map<const generator_data*, std::unique_ptr<window_pair_table>> tables;
+    const auto& gen_data = get_generator_data(index);
+#if !defined(__wasm__)
+    const std::lock_guard<std::mutex> lock(window_pair_tables_mutex);
+#endif
+    auto& table = tables[&gen_data];
+    if (table) {
+        return *table;
+    }
+
+    const fixed_base_ladder* ladder = gen_data.get_hash_ladder(NUM_HASH_BITS);
+    std::vector<grumpkin::g1::element> temp(WINDOW_PAIR_TABLE_SIZE);
+    for (size_t skew = 0; skew < 2; ++skew) {
+        for (size_t code = 0; code < 4; ++code) {
+            auto& entry = temp[4 * skew + code];
+            entry = grumpkin::g1::element(ladder[0].one) + get_window_point(ladder[1], code);
+            if (skew == 1) {
+                entry -= gen_data.skew_generator;
+            }
+        }
+    }
+    for (size_t j = 1; j < NUM_WINDOW_PAIRS; ++j) {
+        for (size_t code_a = 0; code_a < 4; ++code_a) {
+            for (size_t code_b = 0; code_b < 4; ++code_b) {
+                temp[FIRST_PAIR_TABLE_SIZE + (j - 1) * PAIR_TABLE_SIZE + 4 * code_a + code_b] =
+                    get_window_point(ladder[2 * j], code_a) + get_window_point(ladder[2 * j + 1], code_b);
+            }
+        }
+    }
+    grumpkin::g1::element::batch_normalize(temp.data(), temp.size());
+    table = std::make_unique<window_pair_table>(temp.begin(), temp.end());
+    return *table;
+}
+
+/**
+ * @brief Write the table points whose sum is commit_single(input, index) to `points`
+ */
+void get_commit_single_points(const barretenberg::fr& input,
+                              const grumpkin::g1::affine_element* table,
+                              grumpkin::g1::affine_element* points)
+{
+    constexpr size_t num_wnaf_bits = (NUM_HASH_QUADS << 1) + 1;
+    barretenberg::fr scalar_multiplier = input.from_montgomery_form();
+    uint64_t wnaf_entries[NUM_HASH_QUADS + 2] = { 0 };
+    bool skew = false;
+    barretenberg::wnaf::fixed_wnaf<num_wnaf_bits, 1, 2>(&scalar_multiplier.data[0], &wnaf_entries[0], skew, 0);
+
+    points[0] = table[4 * static_cast<size_t>(skew) + get_window_code(wnaf_entries[1])];
+    for (size_t j = 1; j < NUM_WINDOW_PAIRS; ++j) {
+        const size_t code_a = get_window_code(wnaf_entries[2 * j]);
+        const size_t code_b = get_window_code(wnaf_entries[2 * j + 1]);
+        points[j] = table[FIRST_PAIR_TABLE_SIZE + (j - 1) * PAIR_TABLE_SIZE + 4 * code_a + code_b];
+    }
+}
+} // namespace
+
+/**
+ * @brief Compute commit_native over each group of `num_inputs_per_commitment` consecutive elements of `inputs`
+ *
+ * @details Each input contributes 64 points, read from the window pair table of its generator (see
+ * get_window_pair_table), where commit_single adds 128 ladder points. The points of a block of commitments are summed
+ * in affine coordinates with add_affine_points_with_edge_cases, which shares one inversion between all of the
+ * additions at each level of the summation tree. Blocks are committed in parallel.
+ */
+std::vector<grumpkin::g1::affine_element> commit_native_batch(std::span<const grumpkin::fq> inputs,
+                                                              const size_t num_inputs_per_commitment,
+                                                              const size_t hash_index)
+{
+    ASSERT(num_inputs_per_commitment > 0 && inputs.size() % num_inputs_per_commitment == 0);
+    ASSERT((num_inputs_per_commitment < (1 << 16)) && "too many inputs for 16 bit index");
+    const size_t num_commitments = inputs.size() / num_inputs_per_commitment;
+
+    std::vector<const grumpkin::g1::affine_element*> tables(num_inputs_per_commitment);
+    for (size_t i = 0; i < num_inputs_per_commitment; ++i) {
+        tables[i] = get_window_pair_table({ hash_index, i }).data();
+    }
+
+    // The sum is formed in a binary tree, so each commitment's points are padded to a power of two with points at
+    // infinity.
+    const size_t num_table_points = num_inputs_per_commitment * NUM_WINDOW_PAIRS;
+    size_t points_per_commitment = 1UL << numeric::get_msb(num_table_points);
+    points_per_commitment <<= (points_per_commitment < num_table_points) ? 1 : 0;
+    const size_t commitments_per_block = std::max<size_t>(POINTS_PER_BLOCK / points_per_commitment, 1);
+    std::vector<grumpkin::g1::affine_element> results(num_commitments);
+
+    parallel_for_range(0, num_commitments, commitments_per_block, [&](size_t start, size_t end) {
+        std::vector<grumpkin::g1::affine_element> points(commitments_per_block * points_per_commitment);
+        std::vector<grumpkin::fq> scratch_space(points.size() / 2);
+        for (size_t block_start = start; block_start < end; block_start += commitments_per_block) {
+            const size_t block_size = std::min(commitments_per_block, end - block_start);
+            for (size_t i = 0; i < block_size; ++i) {
+                auto* group = &points[i * points_per_commitment];
+                for (size_t k = 0; k < num_inputs_per_commitment; ++k) {
+                    get_commit_single_points(inputs[(block_start + i) * num_inputs_per_commitment + k],
+                                             tables[k],
+                                             group + k * NUM_WINDOW_PAIRS);
+                }
+                for (size_t j = num_table_points; j < points_per_commitment; ++j) {
+                    group[j].self_set_infinity();
+                }
+            }
+
+            // Each call adds adjacent pairs of points, writing the sums to the upper half of the range.
+            auto* sums = points.data();
+            size_t num_points = block_size * points_per_commitment;
+            for (size_t group_size = points_per_commitment; group_size > 1; group_size >>= 1) {
+                barretenberg::scalar_multiplication::add_affine_points_with_edge_cases<curve::Grumpkin>(
+                    sums, num_points, scratch_space.data());
+                sums += num_points / 2;
+                num_points /= 2;
+            }
+            for (size_t i = 0; i < block_size; ++i) {
+                results[block_start + i] =
+                    sums[i].is_point_at_infinity() ? grumpkin::g1::affine_element(0, 0) : sums[i];
+            }
+        }
+    });
+    return results;
+}
+
+std::vector<grumpkin::fq> compress_native_batch(std::span<const grumpkin::fq> inputs,
+                                                const size_t num_inputs_per_commitment,
+                                                const size_t hash_index)
+{
+    const auto commitments = commit_native_batch(inputs, num_inputs_per_commitment, hash_index);
+    std::vector<grumpkin::fq> results(commitments.size());
+    for (size_t i = 0; i < commitments.size(); ++i) {
+        results[i] = commitments[i].x;
+    }
+    return results;
+}
+
 } // namespace pedersen_commitment
 } // namespace crypto
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "../generators/generator_data.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <array>
+#include <span>
 
 namespace crypto {
 namespace pedersen_commitment {
@@ -28,5 +29,13 @@ grumpkin::fq compress_native(const std::vector<uint8_t>& input, const size_t has
 
 grumpkin::fq compress_native(const std::vector<std::pair<grumpkin::fq, generators::generator_index_t>>& input_pairs);
 
+std::vector<grumpkin::g1::affine_element> commit_native_batch(std::span<const grumpkin::fq> inputs,
+                                                              const size_t num_inputs_per_commitment,
+                                                              const size_t hash_index = 0);
+
+std::vector<grumpkin::fq> compress_native_batch(std::span<const grumpkin::fq> inputs,
+                                                const size_t num_inputs_per_commitment,
+                                                const size_t hash_index = 0);
+
 } // namespace pedersen_commitment
 } // namespace crypto
@@ -0,0 +1,41 @@
+#include "barretenberg/numeric/random/engine.hpp"
+#include <gtest/gtest.h>
+
+#include "./pedersen.hpp"
+
+namespace {
+auto& engine = numeric::random::get_debug_engine();
+}
+
+TEST(pedersen_commitment, commit_native_batch)
+{
+    typedef grumpkin::fq fq;
+
+    for (const size_t num_inputs_per_commitment : { 1UL, 2UL, 3UL }) {
+        constexpr size_t num_commitments = 50;
+        std::vector<fq> inputs(num_commitments * num_inputs_per_commitment);
+        for (auto& input : inputs) {
+            input = engine.get_random_uint256();
+        }
+        // Small, zero and even scalars exercise the start of the ladder and the skew correction.
+        inputs[0] = fq(1);
+        for (size_t i = 0; i < num_inputs_per_commitment; ++i) {
+            inputs[num_inputs_per_commitment + i] = fq::zero();
+        }
+
+        const auto results =
+            crypto::pedersen_commitment::commit_native_batch(inputs, num_inputs_per_commitment, /*hash_index=*/2);
+        const auto compressed =
+            crypto::pedersen_commitment::compress_native_batch(inputs, num_inputs_per_commitment, /*hash_index=*/2);
+
+        ASSERT_EQ(results.size(), num_commitments);
+        for (size_t i = 0; i < num_commitments; ++i) {
+            const std::vector<fq> commitment_inputs(
+                inputs.begin() + static_cast<ptrdiff_t>(i * num_inputs_per_commitment),
+                inputs.begin() + static_cast<ptrdiff_t>((i + 1) * num_inputs_per_commitment));
+            const auto expected = crypto::pedersen_commitment::commit_native(commitment_inputs, 2);
+            EXPECT_EQ(results[i], expected);
+            EXPECT_EQ(compressed[i], expected.x);
+        }
+    }
+}
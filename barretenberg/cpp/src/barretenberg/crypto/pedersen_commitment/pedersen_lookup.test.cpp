@@ -260,3 +260,50 @@ TEST(pedersen_lookup, merkle_damgard_tree_compress)
                              compute_expected(fq(m), (crypto::pedersen_hash::lookup::NUM_PEDERSEN_TABLES / 2)))
                   .x);
 }
+
+TEST(pedersen_lookup, hash_pair_batch)
+{
+    typedef grumpkin::fq fq;
+
+    // More pairs than fit in one block, so that blocks are split between threads.
+    constexpr size_t num_pairs = 200;
+    std::vector<fq> lefts(num_pairs);
+    std::vector<fq> rights(num_pairs);
+    for (size_t i = 0; i < num_pairs; ++i) {
+        lefts[i] = engine.get_random_uint256();
+        rights[i] = engine.get_random_uint256();
+    }
+    // Equal and zero inputs.
+    rights[0] = lefts[0];
+    lefts[1] = fq::zero();
+    rights[1] = fq::zero();
+
+    const auto results = crypto::pedersen_hash::lookup::hash_pair_batch(lefts, rights);
+
+    ASSERT_EQ(results.size(), num_pairs);
+    for (size_t i = 0; i < num_pairs; ++i) {
+        EXPECT_EQ(results[i], crypto::pedersen_hash::lookup::hash_pair(lefts[i], rights[i]));
+    }
+}
+
+TEST(pedersen_lookup, hash_multiple_batch)
+{
+    typedef grumpkin::fq fq;
+
+    for (const size_t num_inputs_per_hash : { 1UL, 2UL, 5UL }) {
+        constexpr size_t num_hashes = 70;
+        std::vector<fq> inputs(num_hashes * num_inputs_per_hash);
+        for (auto& input : inputs) {
+            input = engine.get_random_uint256();
+        }
+
+        const auto results = crypto::pedersen_hash::lookup::hash_multiple_batch(inputs, num_inputs_per_hash, 3);
+
+        ASSERT_EQ(results.size(), num_hashes);
+        for (size_t i = 0; i < num_hashes; ++i) {
+            const std::vector<fq> hash_inputs(inputs.begin() + static_cast<ptrdiff_t>(i * num_inputs_per_hash),
+                                              inputs.begin() + static_cast<ptrdiff_t>((i + 1) * num_inputs_per_hash));
+            EXPECT_EQ(results[i], crypto::pedersen_hash::lookup::hash_multiple(hash_inputs, 3));
+        }
+    }
+}
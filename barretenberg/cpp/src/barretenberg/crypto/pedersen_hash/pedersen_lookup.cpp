@@ -4,7 +4,9 @@
 
 #include <mutex>
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 
 namespace crypto {
 namespace pedersen_hash {
@@ -182,6 +184,157 @@ grumpkin::fq hash_multiple(const std::vector<grumpkin::fq>& inputs, const size_t
     return final_result.x;
 }
 
+namespace {
+// A pair hash sums 15 + 14 table points for each of its two inputs. The sum is formed in a binary tree, so each pair
+// gets a power-of-two group of points; the unused slots hold points at infinity. An input shared by every pair
+// contributes one precomputed point instead, so such pairs fit in half the space.
+constexpr size_t POINTS_PER_SINGLE_HASH = NUM_PEDERSEN_TABLES - 1;
+constexpr size_t POINTS_PER_PAIR_HASH = 64;
+constexpr size_t POINTS_PER_PAIR_HASH_WITH_SHARED_INPUT = 32;
+static_assert(2 * POINTS_PER_SINGLE_HASH <= POINTS_PER_PAIR_HASH);
+static_assert(POINTS_PER_SINGLE_HASH + 1 <= POINTS_PER_PAIR_HASH_WITH_SHARED_INPUT);
+// Pairs hashed together share each batch inversion. Their points (256kb) still fit in L2.
+constexpr size_t POINTS_PER_BLOCK = 4096;
+
+/**
+ * @brief Write the table points whose sum is hash_single(input, parity) to `points`
+ *
+ * @details The endomorphism that hash_single applies to its first accumulator is applied to each of that accumulator's
+ * points instead, as (x, y) -> (beta * x, y) is a group homomorphism.
+ */
+grumpkin::g1::affine_element* get_hash_single_points(const grumpkin::fq& input,
+                                                     const bool parity,
+                                                     const grumpkin::fq& beta,
+                                                     grumpkin::g1::affine_element* points)
+{
+    uint256_t bits(input);
+    constexpr size_t num_rounds = NUM_PEDERSEN_TABLES / 2;
+    constexpr uint64_t table_mask = PEDERSEN_TABLE_SIZE - 1;
+    const size_t table_index_offset = parity ? (NUM_PEDERSEN_TABLES / 2) : 0;
+    for (size_t i = 0; i < num_rounds; ++i) {
+        const uint64_t slice_a = (bits.data[0] & table_mask);
+        bits >>= BITS_PER_TABLE;
+        const uint64_t slice_b = (bits.data[0] & table_mask);
+        bits >>= BITS_PER_TABLE;
+
+        const auto& table = pedersen_tables[table_index_offset + i];
+        const auto& point_a = table[static_cast<size_t>(slice_a)];
+        *points++ = grumpkin::g1::affine_element(point_a.x * beta, point_a.y);
+        if (i < (num_rounds - 1)) {
+            *points++ = table[static_cast<size_t>(slice_b)];
+        }
+    }
+    return points;
+}
+
+/**
+ * @brief hash_pair(lefts[i], rights[i]) for every i, where a side holding a single element pairs it with every
+ * element of the other side
+ *
+ * @details Instead of summing the table points of each pair in Jacobian coordinates and normalising the result, the
+ * points of a block of pairs are summed in affine coordinates with add_affine_points_with_edge_cases, which shares one
+ * inversion between all of the additions at each level of the summation tree. Blocks are hashed in parallel.
+ */
+std::vector<grumpkin::fq> hash_pairs(std::span<const grumpkin::fq> lefts, std::span<const grumpkin::fq> rights)
+{
+    const size_t num_pairs = std::max(lefts.size(), rights.size());
+    ASSERT(lefts.size() == num_pairs || lefts.size() == 1);
+    ASSERT(rights.size() == num_pairs || rights.size() == 1);
+    const bool shared_left = lefts.size() == 1 && num_pairs > 1;
+    const bool shared_right = rights.size() == 1 && num_pairs > 1;
+    grumpkin::g1::affine_element shared_point;
+    if (shared_left) {
+        shared_point = grumpkin::g1::affine_element(hash_single(lefts[0], false));
+    } else if (shared_right) {
+        shared_point = grumpkin::g1::affine_element(hash_single(rights[0], true));
+    }
+    const size_t points_per_pair =
+        (shared_left || shared_right) ? POINTS_PER_PAIR_HASH_WITH_SHARED_INPUT : POINTS_PER_PAIR_HASH;
+    const size_t pairs_per_block = POINTS_PER_BLOCK / points_per_pair;
+    const grumpkin::fq beta = grumpkin::fq::cube_root_of_unity();
+    std::vector<grumpkin::fq> results(num_pairs);
+
+    parallel_for_range(0, num_pairs, pairs_per_block, [&](size_t start, size_t end) {
+        const size_t max_block_size = std::min(pairs_per_block, end - start);
+        std::vector<grumpkin::g1::affine_element> points(max_block_size * points_per_pair);
+        std::vector<grumpkin::fq> scratch_space(points.size() / 2);
+        for (size_t block_start = start; block_start < end; block_start += pairs_per_block) {
+            const size_t block_size = std::min(pairs_per_block, end - block_start);
+            for (size_t i = 0; i < block_size; ++i) {
+                auto* group = &points[i * points_per_pair];
+                auto* group_end = group;
+                if (shared_left) {
+                    *group_end++ = shared_point;
+                } else {
+                    group_end = get_hash_single_points(lefts[block_start + i], false, beta, group_end);
+                }
+                if (shared_right) {
+                    *group_end++ = shared_point;
+                } else {
+                    group_end = get_hash_single_points(rights[block_start + i], true, beta, group_end);
+                }
+                for (; group_end != group + points_per_pair; ++group_end) {
+                    group_end->self_set_infinity();
+                }
+            }
+
+            // Each call adds adjacent pairs of points, writing the sums to the upper half of the range.
+            auto* sums = points.data();
+            size_t num_points = block_size * points_per_pair;
+            for (size_t group_size = points_per_pair; group_size > 1; group_size >>= 1) {
+                barretenberg::scalar_multiplication::add_affine_points_with_edge_cases<curve::Grumpkin>(
+                    sums, num_points, scratch_space.data());
+                sums += num_points / 2;
+                num_points /= 2;
+            }
+            for (size_t i = 0; i < block_size; ++i) {
+                results[block_start + i] = sums[i].x;
+            }
+        }
+    });
+    return results;
+}
+} // namespace
+
+/**
+ * @brief Compute hash_pair(lefts[i], rights[i]) for every i, hashing all of the pairs together
+ */
+std::vector<grumpkin::fq> hash_pair_batch(std::span<const grumpkin::fq> lefts, std::span<const grumpkin::fq> rights)
+{
+    ASSERT(lefts.size() == rights.size());
+    init();
+    return hash_pairs(lefts, rights);
+}
+
+/**
+ * @brief Compute hash_multiple over each group of `num_inputs_per_hash` consecutive elements of `inputs`
+ *
+ * @details The groups advance through the Merkle-Damgard chain of hash_multiple together, so every step is a single
+ * batch of pair hashes. The IV that starts the chain and the input count that ends it are the same for every group.
+ */
+std::vector<grumpkin::fq> hash_multiple_batch(std::span<const grumpkin::fq> inputs,
+                                              const size_t num_inputs_per_hash,
+                                              const size_t hash_index)
+{
+    ASSERT(num_inputs_per_hash > 0 && inputs.size() % num_inputs_per_hash == 0);
+    init();
+    const size_t num_hashes = inputs.size() / num_inputs_per_hash;
+    if (num_hashes == 0) {
+        return {};
+    }
+
+    std::vector<grumpkin::fq> results = { pedersen_iv_table[hash_index].x };
+    std::vector<grumpkin::fq> rights(num_hashes);
+    for (size_t j = 0; j < num_inputs_per_hash; ++j) {
+        for (size_t i = 0; i < num_hashes; ++i) {
+            rights[i] = inputs[i * num_inputs_per_hash + j];
+        }
+        results = hash_pairs(results, rights);
+    }
+    const grumpkin::fq num_inputs(num_inputs_per_hash);
+    return hash_pairs(results, std::span(&num_inputs, 1));
+}
+
 } // namespace lookup
 } // namespace pedersen_hash
 } // namespace crypto
\ No newline at end of file
@@ -2,6 +2,7 @@
 // TODO(@zac-wiliamson #2341 delete this file once we migrate to new hash standard
 
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <span>
 
 namespace crypto {
 namespace pedersen_hash {
@@ -40,6 +41,12 @@ grumpkin::fq hash_pair(const grumpkin::fq& left, const grumpkin::fq& right);
 
 grumpkin::fq hash_multiple(const std::vector<grumpkin::fq>& inputs, const size_t hash_index = 0);
 
+std::vector<grumpkin::fq> hash_pair_batch(std::span<const grumpkin::fq> lefts, std::span<const grumpkin::fq> rights);
+
+std::vector<grumpkin::fq> hash_multiple_batch(std::span<const grumpkin::fq> inputs,
+                                              const size_t num_inputs_per_hash,
+                                              const size_t hash_index = 0);
+
 } // namespace lookup
 } // namespace pedersen_hash
 } // namespace crypto
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "sha256.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+
+namespace {
+constexpr size_t NUM_MESSAGES = 1 << 12;
+
+std::vector<std::vector<uint8_t>> generate_messages(size_t message_size)
+{
+    std::vector<std::vector<uint8_t>> messages(NUM_MESSAGES, std::vector<uint8_t>(message_size));
+    for (size_t i = 0; i < NUM_MESSAGES; ++i) {
+        for (size_t j = 0; j < message_size; ++j) {
+            messages[i][j] = static_cast<uint8_t>(i * 31 + j);
+        }
+    }
+    return messages;
+}
+} // namespace
+
+void sha256_block_bench(State& state) noexcept
+{
+    auto blocks = generate_messages(64);
+    for (auto _ : state) {
+        for (const auto& block : blocks) {
+            DoNotOptimize(sha256::sha256_block(block));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_MESSAGES));
+}
+BENCHMARK(sha256_block_bench)->Unit(kMicrosecond);
+
+void sha256_batch_bench(State& state) noexcept
+{
+    const auto kernel = static_cast<sha256::BatchKernel>(state.range(0));
+    if (!sha256::batch_kernel_supported(kernel)) {
+        state.SkipWithError("kernel not supported on this CPU");
+        return;
+    }
+    auto messages = generate_messages(static_cast<size_t>(state.range(1)));
+    for (auto _ : state) {
+        DoNotOptimize(sha256::sha256_batch(messages, kernel));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_MESSAGES));
+}
+// 55 bytes is the longest message that pads to a single block, i.e. one compression as in sha256_block
+BENCHMARK(sha256_batch_bench)
+    ->ArgsProduct({ { static_cast<int64_t>(sha256::BatchKernel::SCALAR),
+                      static_cast<int64_t>(sha256::BatchKernel::SSE2),
+                      static_cast<int64_t>(sha256::BatchKernel::AVX2),
+                      static_cast<int64_t>(sha256::BatchKernel::AVX512),
+                      static_cast<int64_t>(sha256::BatchKernel::SHA_NI) },
+                    { 55, 64, 1024 } })
+    ->Unit(kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -1,8 +1,15 @@
 #include "./sha256.hpp"
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/net.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
 #include <array>
 #include <memory.h>
+#include <numeric>
+#if defined(__x86_64__)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
 
 namespace sha256 {
 
@@ -182,4 +189,360 @@ template hash sha256<std::array<uint8_t, 32>>(const std::array<uint8_t, 32>& inp
 template hash sha256<std::string>(const std::string& input);
 template hash sha256<std::span<uint8_t>>(const std::span<uint8_t>& input);
 
+namespace {
+
+uint32_t read_word(const uint8_t* bytes)
+{
+    uint32_t word = 0;
+    memcpy((void*)&word, (void*)bytes, 4);
+    return is_little_endian() ? __builtin_bswap32(word) : word;
+}
+
+void write_word(uint32_t word, uint8_t* bytes)
+{
+    for (size_t i = 0; i < 4; ++i) {
+        bytes[i] = static_cast<uint8_t>(word >> (24 - (i * 8)));
+    }
+}
+
+/**
+ * @brief The padded forms of a batch of messages, stored back to back
+ */
+struct PaddedMessages {
+    std::vector<uint8_t> data;
+    std::vector<size_t> offsets;
+    std::vector<size_t> num_blocks;
+};
+
+PaddedMessages pad_messages(const std::vector<std::vector<uint8_t>>& inputs)
+{
+    PaddedMessages padded;
+    padded.offsets.reserve(inputs.size());
+    padded.num_blocks.reserve(inputs.size());
+    size_t total_size = 0;
+    for (const auto& input : inputs) {
+        // the message is followed by a 0x80 byte and its 8-byte bit length
+        const size_t num_blocks = (input.size() + 8) / 64 + 1;
+        padded.offsets.push_back(total_size);
+        padded.num_blocks.push_back(num_blocks);
+        total_size += num_blocks * 64;
+    }
+    padded.data.resize(total_size);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        uint8_t* message = &padded.data[padded.offsets[i]];
+        const size_t padded_size = padded.num_blocks[i] * 64;
+        std::copy(inputs[i].begin(), inputs[i].end(), message);
+        message[inputs[i].size()] = 0x80;
+        const uint64_t num_bits = inputs[i].size() * 8;
+        for (size_t j = 0; j < 8; ++j) {
+            message[padded_size - 8 + j] = static_cast<uint8_t>(num_bits >> (56 - (j * 8)));
+        }
+    }
+    return padded;
+}
+
+void hash_scalar(const uint8_t* message, size_t num_blocks, hash& output)
+{
+    std::array<uint32_t, 8> rolling_hash;
+    prepare_constants(rolling_hash);
+    for (size_t block = 0; block < num_blocks; ++block) {
+        std::array<uint32_t, 16> hash_input;
+        for (size_t i = 0; i < 16; ++i) {
+            hash_input[i] = read_word(message + block * 64 + i * 4);
+        }
+        rolling_hash = sha256_block(rolling_hash, hash_input);
+    }
+    for (size_t i = 0; i < 8; ++i) {
+        write_word(rolling_hash[i], &output[i * 4]);
+    }
+}
+
+#if defined(__x86_64__)
+
+using u32x4 = uint32_t __attribute__((vector_size(16)));
+using u32x8 = uint32_t __attribute__((vector_size(32)));
+using u32x16 = uint32_t __attribute__((vector_size(64)));
+
+/**
+ * @brief The SHA-256 compression function applied to one block in every lane of `Vec`
+ * @details Vectors are only passed by pointer, and the function is always inlined into a kernel compiled for the
+ * matching instruction set, so the lane arithmetic is emitted with that kernel's registers.
+ */
+template <typename Vec> [[gnu::always_inline]] inline void compress_lanes(Vec* state, Vec* w)
+{
+    for (size_t i = 16; i < 64; ++i) {
+        const Vec w15 = w[i - 15];
+        const Vec w2 = w[i - 2];
+        const Vec s0 = ((w15 >> 7U) | (w15 << 25U)) ^ ((w15 >> 18U) | (w15 << 14U)) ^ (w15 >> 3U);
+        const Vec s1 = ((w2 >> 17U) | (w2 << 15U)) ^ ((w2 >> 19U) | (w2 << 13U)) ^ (w2 >> 10U);
+        w[i] = w[i - 16] + w[i - 7] + s0 + s1;
+    }
+
+    Vec a = state[0];
+    Vec b = state[1];
+    Vec c = state[2];
+    Vec d = state[3];
+    Vec e = state[4];
+    Vec f = state[5];
+    Vec g = state[6];
+    Vec h = state[7];
+    for (size_t i = 0; i < 64; ++i) {
+        const Vec S1 = ((e >> 6U) | (e << 26U)) ^ ((e >> 11U) | (e << 21U)) ^ ((e >> 25U) | (e << 7U));
+        const Vec ch = (e & f) ^ (~e & g);
+        const Vec temp1 = h + S1 + ch + round_constants[i] + w[i];
+        const Vec S0 = ((a >> 2U) | (a << 30U)) ^ ((a >> 13U) | (a << 19U)) ^ ((a >> 22U) | (a << 10U));
+        const Vec maj = (a & b) ^ (a & c) ^ (b & c);
+        const Vec temp2 = S0 + maj;
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+/**
+ * @brief Hash one message per lane. Every message must pad to `num_blocks` blocks.
+ */
+template <typename Vec, size_t LANES>
+[[gnu::always_inline]] inline void hash_lane_group(const uint8_t* const* messages,
+                                                   size_t num_blocks,
+                                                   hash* const* outputs)
+{
+    Vec state[8];
+    for (size_t i = 0; i < 8; ++i) {
+        state[i] = Vec{} + init_constants[i];
+    }
+    for (size_t block = 0; block < num_blocks; ++block) {
+        Vec w[64];
+        for (size_t i = 0; i < 16; ++i) {
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                w[i][lane] = read_word(messages[lane] + block * 64 + i * 4);
+            }
+        }
+        compress_lanes(state, w);
+    }
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        for (size_t i = 0; i < 8; ++i) {
+            write_word(state[i][lane], &(*outputs[lane])[i * 4]);
+        }
+    }
+}
+
+__attribute__((target("sse2"))) void hash_lane_group_sse2(const uint8_t* const* messages,
+                                                          size_t num_blocks,
+                                                          hash* const* outputs)
+{
+    hash_lane_group<u32x4, 4>(messages, num_blocks, outputs);
+}
+
+__attribute__((target("avx2"))) void hash_lane_group_avx2(const uint8_t* const* messages,
+                                                          size_t num_blocks,
+                                                          hash* const* outputs)
+{
+    hash_lane_group<u32x8, 8>(messages, num_blocks, outputs);
+}
+
+__attribute__((target("avx512f"))) void hash_lane_group_avx512(const uint8_t* const* messages,
+                                                               size_t num_blocks,
+                                                               hash* const* outputs)
+{
+    hash_lane_group<u32x16, 16>(messages, num_blocks, outputs);
+}
+
+/**
+ * @brief Hash one message with the SHA extensions
+ * @details The state is kept in the ABEF/CDGH register layout expected by sha256rnds2. Each iteration runs four
+ * rounds and extends the message schedule by four words. The SHA instructions only have legacy SSE encodings, so the
+ * kernel is kept out of line: inlined next to an AVX kernel they could run with dirty upper register state, which
+ * costs a state transition per instruction.
+ */
+__attribute__((target("sha,sse4.1"), noinline)) void hash_sha_ni(const uint8_t* message,
+                                                                 size_t num_blocks,
+                                                                 hash& output)
+{
+    // reverses the bytes of each 32-bit word
+    const __m128i byte_swap = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+    __m128i dcba = _mm_loadu_si128((const __m128i*)&init_constants[0]);
+    __m128i hgfe = _mm_loadu_si128((const __m128i*)&init_constants[4]);
+    __m128i cdab = _mm_shuffle_epi32(dcba, 0xB1);
+    __m128i efgh = _mm_shuffle_epi32(hgfe, 0x1B);
+    __m128i abef = _mm_alignr_epi8(cdab, efgh, 8);
+    __m128i cdgh = _mm_blend_epi16(efgh, cdab, 0xF0);
+
+    for (size_t block = 0; block < num_blocks; ++block) {
+        const __m128i abef_save = abef;
+        const __m128i cdgh_save = cdgh;
+
+        __m128i schedule[4];
+        for (size_t i = 0; i < 4; ++i) {
+            const auto* words = (const __m128i*)(message + block * 64 + i * 16);
+            schedule[i] = _mm_shuffle_epi8(_mm_loadu_si128(words), byte_swap);
+        }
+        for (size_t i = 0; i < 16; ++i) {
+            const __m128i constants = _mm_loadu_si128((const __m128i*)&round_constants[i * 4]);
+            const __m128i words = _mm_add_epi32(schedule[i % 4], constants);
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, words);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(words, 0x0E));
+            if (i < 12) {
+                // W[i + 4] = msg2(msg1(W[i], W[i + 1]) + (W[i + 2], W[i + 3]) shifted by one word, W[i + 3])
+                const __m128i& w3 = schedule[(i + 3) % 4];
+                __m128i next = _mm_sha256msg1_epu32(schedule[i % 4], schedule[(i + 1) % 4]);
+                next = _mm_add_epi32(next, _mm_alignr_epi8(w3, schedule[(i + 2) % 4], 4));
+                schedule[i % 4] = _mm_sha256msg2_epu32(next, w3);
+            }
+        }
+
+        abef = _mm_add_epi32(abef, abef_save);
+        cdgh = _mm_add_epi32(cdgh, cdgh_save);
+    }
+
+    const __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+    const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+    std::array<uint32_t, 8> state;
+    _mm_storeu_si128((__m128i*)&state[0], _mm_blend_epi16(feba, dchg, 0xF0));
+    _mm_storeu_si128((__m128i*)&state[4], _mm_alignr_epi8(dchg, feba, 8));
+    for (size_t i = 0; i < 8; ++i) {
+        write_word(state[i], &output[i * 4]);
+    }
+}
+
+bool cpu_supports_sha_ni()
+{
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+        return false;
+    }
+    return (ebx & (1U << 29)) != 0 && __builtin_cpu_supports("sse4.1");
+}
+
+using LaneGroupHasher = void (*)(const uint8_t* const*, size_t, hash* const*);
+
+/**
+ * @brief Hash a batch `LANES` messages at a time
+ * @details Messages are ordered by block count so that the lanes of a group all run the same number of compressions.
+ * A group that cannot be filled repeats its last message in the spare lanes and discards their output.
+ */
+template <size_t LANES>
+void hash_in_lane_groups(const PaddedMessages& padded, std::vector<hash>& outputs, LaneGroupHasher hasher)
+{
+    const size_t num_messages = padded.offsets.size();
+    std::vector<size_t> order(num_messages);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        return padded.num_blocks[lhs] < padded.num_blocks[rhs];
+    });
+
+    std::array<hash, LANES> spare_outputs;
+    for (size_t start = 0; start < num_messages;) {
+        const size_t num_blocks = padded.num_blocks[order[start]];
+        size_t end = start + 1;
+        while (end < num_messages && end - start < LANES && padded.num_blocks[order[end]] == num_blocks) {
+            ++end;
+        }
+        std::array<const uint8_t*, LANES> lane_messages;
+        std::array<hash*, LANES> lane_outputs;
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            const size_t index = order[std::min(start + lane, end - 1)];
+            lane_messages[lane] = &padded.data[padded.offsets[index]];
+            lane_outputs[lane] = (start + lane < end) ? &outputs[index] : &spare_outputs[lane];
+        }
+        hasher(lane_messages.data(), num_blocks, lane_outputs.data());
+        start = end;
+    }
+}
+
+#endif
+
+} // namespace
+
+bool batch_kernel_supported(BatchKernel kernel)
+{
+#if defined(__x86_64__)
+    switch (kernel) {
+    case BatchKernel::SCALAR:
+    case BatchKernel::SSE2:
+        return true;
+    case BatchKernel::AVX2:
+        return __builtin_cpu_supports("avx2");
+    case BatchKernel::AVX512:
+        return __builtin_cpu_supports("avx512f");
+    case BatchKernel::SHA_NI:
+        return cpu_supports_sha_ni();
+    }
+    return false;
+#else
+    return kernel == BatchKernel::SCALAR;
+#endif
+}
+
+BatchKernel best_batch_kernel()
+{
+    // Sixteen AVX-512 lanes outrun one SHA-NI message at a time on long batches; SHA-NI in turn beats the narrower
+    // multi-lane kernels on most CPUs that have it.
+    static const BatchKernel best = [] {
+        for (auto kernel : { BatchKernel::AVX512, BatchKernel::SHA_NI, BatchKernel::AVX2, BatchKernel::SSE2 }) {
+            if (batch_kernel_supported(kernel)) {
+                return kernel;
+            }
+        }
+        return BatchKernel::SCALAR;
+    }();
+    return best;
+}
+
+std::vector<hash> sha256_batch(const std::vector<std::vector<uint8_t>>& inputs)
+{
+    return sha256_batch(inputs, best_batch_kernel());
+}
+
+std::vector<hash> sha256_batch(const std::vector<std::vector<uint8_t>>& inputs, BatchKernel kernel)
+{
+    if (!batch_kernel_supported(kernel)) {
+        throw_or_abort("sha256_batch: kernel not supported by this CPU");
+    }
+    const PaddedMessages padded = pad_messages(inputs);
+    std::vector<hash> outputs(inputs.size());
+#if defined(__x86_64__)
+    switch (kernel) {
+    case BatchKernel::SSE2:
+        hash_in_lane_groups<4>(padded, outputs, hash_lane_group_sse2);
+        return outputs;
+    case BatchKernel::AVX2:
+        hash_in_lane_groups<8>(padded, outputs, hash_lane_group_avx2);
+        return outputs;
+    case BatchKernel::AVX512:
+        hash_in_lane_groups<16>(padded, outputs, hash_lane_group_avx512);
+        return outputs;
+    case BatchKernel::SHA_NI:
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            hash_sha_ni(&padded.data[padded.offsets[i]], padded.num_blocks[i], outputs[i]);
+        }
+        return outputs;
+    case BatchKernel::SCALAR:
+        break;
+    }
+#endif
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        hash_scalar(&padded.data[padded.offsets[i]], padded.num_blocks[i], outputs[i]);
+    }
+    return outputs;
+}
+
 } // namespace sha256
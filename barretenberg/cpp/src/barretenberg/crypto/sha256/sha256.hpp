@@ -19,6 +19,24 @@ extern template hash sha256<std::vector<uint8_t>>(const std::vector<uint8_t>& in
 extern template hash sha256<std::array<uint8_t, 32>>(const std::array<uint8_t, 32>& input);
 extern template hash sha256<std::string>(const std::string& input);
 
+/**
+ * @brief Implementations available to sha256_batch. The multi-lane kernels hash 4 (SSE2), 8 (AVX2) or 16 (AVX-512)
+ * messages at once, one per 32-bit lane. SHA_NI hashes one message at a time using the x86 SHA extensions.
+ */
+enum class BatchKernel { SCALAR, SSE2, AVX2, AVX512, SHA_NI };
+
+bool batch_kernel_supported(BatchKernel kernel);
+BatchKernel best_batch_kernel();
+
+/**
+ * @brief Hash many independent messages, using the fastest kernel supported by the CPU
+ * @details Messages that pad to the same number of blocks share a lane group, so batches of equal-length messages
+ * make full use of the lanes.
+ */
+std::vector<hash> sha256_batch(const std::vector<std::vector<uint8_t>>& inputs);
+// Uses the given kernel, which must be supported by the CPU (see batch_kernel_supported)
+std::vector<hash> sha256_batch(const std::vector<std::vector<uint8_t>>& inputs, BatchKernel kernel);
+
 inline barretenberg::fr sha256_to_field(std::vector<uint8_t> const& input)
 {
     auto result = sha256::sha256(input);
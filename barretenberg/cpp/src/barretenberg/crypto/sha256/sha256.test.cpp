@@ -98,3 +98,34 @@ TEST(misc_sha256, test_NIST_vector_five)
         EXPECT_EQ(result[i], expected[i]);
     }
 }
+
+TEST(misc_sha256, test_batch_matches_single)
+{
+    // Lengths either side of the 55/56 byte padding boundary and spanning one to four blocks, with some lengths
+    // repeated more often than others so that lane groups are both filled and left partially empty
+    std::vector<std::vector<uint8_t>> inputs;
+    for (size_t i = 0; i < 300; ++i) {
+        std::vector<uint8_t> input((i * 37) % 200);
+        for (size_t j = 0; j < input.size(); ++j) {
+            input[j] = static_cast<uint8_t>(i + j * 7);
+        }
+        inputs.push_back(input);
+    }
+
+    for (auto kernel : { sha256::BatchKernel::SCALAR,
+                         sha256::BatchKernel::SSE2,
+                         sha256::BatchKernel::AVX2,
+                         sha256::BatchKernel::AVX512,
+                         sha256::BatchKernel::SHA_NI }) {
+        if (!sha256::batch_kernel_supported(kernel)) {
+            EXPECT_THROW(sha256::sha256_batch(inputs, kernel), std::runtime_error);
+            continue;
+        }
+        auto results = sha256::sha256_batch(inputs, kernel);
+        ASSERT_EQ(results.size(), inputs.size());
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            EXPECT_EQ(results[i], sha256::sha256(inputs[i])) << "kernel " << static_cast<int>(kernel);
+        }
+    }
+    EXPECT_TRUE(sha256::sha256_batch({}).empty());
+}
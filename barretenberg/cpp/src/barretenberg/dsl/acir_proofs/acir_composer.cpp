@@ -130,6 +130,39 @@ bool AcirComposer::verify_proof(std::vector<uint8_t> const& proof, bool is_recur
     }
 }
 
+/**
+ * @brief Verifies a batch of proofs against the verification key with a single combined pairing check, returning
+ * whether each of them is valid
+ */
+std::vector<bool> AcirComposer::verify_proofs(std::vector<std::vector<uint8_t>> const& proofs, bool is_recursive)
+{
+    if (!verification_key_) {
+        vinfo("computing verification key...");
+        verification_key_ = composer_.compute_verification_key(builder_);
+        vinfo("done.");
+    }
+    if (proofs.empty()) {
+        return {};
+    }
+
+    // Same hack as in verify_proof, but sized from the verification key, as any of the proofs may be malformed
+    builder_.public_inputs.resize(verification_key_->num_public_inputs);
+
+    std::vector<proof_system::plonk::proof> plonk_proofs;
+    plonk_proofs.reserve(proofs.size());
+    for (const auto& proof : proofs) {
+        plonk_proofs.push_back({ proof });
+    }
+
+    if (is_recursive) {
+        auto verifier = composer_.create_verifier(builder_);
+        return verifier.verify_proofs(plonk_proofs);
+    } else {
+        auto verifier = composer_.create_ultra_with_keccak_verifier(builder_);
+        return verifier.verify_proofs(plonk_proofs);
+    }
+}
+
 std::string AcirComposer::get_solidity_verifier()
 {
     std::ostringstream stream;
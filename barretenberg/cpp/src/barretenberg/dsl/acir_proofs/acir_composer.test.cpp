@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "acir_composer.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+
+namespace acir_proofs::tests {
+
+class AcirComposerTests : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() { barretenberg::srs::init_crs_factory("../srs_db/ignition"); }
+};
+
+TEST_F(AcirComposerTests, VerifyProofsWithTruncatedFirstProof)
+{
+    // w1 + w2 = w3, with w3 public
+    poly_triple constraint{
+        .a = 1,
+        .b = 2,
+        .c = 3,
+        .q_m = 0,
+        .q_l = 1,
+        .q_r = 1,
+        .q_o = -1,
+        .q_c = 0,
+    };
+    acir_format::acir_format constraint_system{
+        .varnum = 4,
+        .public_inputs = { 3 },
+        .logic_constraints = {},
+        .range_constraints = {},
+        .sha256_constraints = {},
+        .schnorr_constraints = {},
+        .ecdsa_k1_constraints = {},
+        .ecdsa_r1_constraints = {},
+        .blake2s_constraints = {},
+        .keccak_constraints = {},
+        .keccak_var_constraints = {},
+        .pedersen_constraints = {},
+        .hash_to_field_constraints = {},
+        .fixed_base_scalar_mul_constraints = {},
+        .recursion_constraints = {},
+        .constraints = { constraint },
+        .block_constraints = {},
+    };
+
+    AcirComposer composer(0, false);
+    acir_format::WitnessVector witness = { 1, 2, 3 };
+    auto proof = composer.create_proof(constraint_system, witness, false);
+    composer.init_verification_key();
+
+    // Shorter than a proof with no public inputs at all
+    std::vector<uint8_t> truncated_proof(proof.begin(), proof.begin() + 100);
+    EXPECT_EQ(composer.verify_proofs({ truncated_proof, proof, proof }, false),
+              std::vector<bool>({ false, true, true }));
+}
+
+} // namespace acir_proofs::tests
@@ -83,6 +83,17 @@ WASM_EXPORT void acir_verify_proof(in_ptr acir_composer_ptr,
     *result = acir_composer->verify_proof(proof, *is_recursive);
 }
 
+WASM_EXPORT void acir_verify_proofs(in_ptr acir_composer_ptr,
+                                    in_buf_vec proofs_buf,
+                                    bool const* is_recursive,
+                                    uint8_t** out)
+{
+    auto acir_composer = reinterpret_cast<acir_proofs::AcirComposer*>(*acir_composer_ptr);
+    auto proofs = from_buffer<std::vector<std::vector<uint8_t>>>(proofs_buf);
+    auto results = acir_composer->verify_proofs(proofs, *is_recursive);
+    *out = to_heap_buffer(std::vector<uint8_t>(results.begin(), results.end()));
+}
+
 WASM_EXPORT void acir_get_solidity_verifier(in_ptr acir_composer_ptr, out_str_buf out)
 {
     auto acir_composer = reinterpret_cast<acir_proofs::AcirComposer*>(*acir_composer_ptr);
@@ -43,6 +43,15 @@ WASM_EXPORT void acir_verify_proof(in_ptr acir_composer_ptr,
                                    bool const* is_recursive,
                                    bool* result);
 
+/**
+ * @brief Verifies a batch of proofs against the loaded verification key. `out` receives one byte per proof, set to 1
+ * if the proof is valid.
+ */
+WASM_EXPORT void acir_verify_proofs(in_ptr acir_composer_ptr,
+                                    in_buf_vec proofs_buf,
+                                    bool const* is_recursive,
+                                    uint8_t** out);
+
 WASM_EXPORT void acir_get_solidity_verifier(in_ptr acir_composer_ptr, out_str_buf out);
 
 WASM_EXPORT void acir_serialize_proof_into_fields(in_ptr acir_composer_ptr,
@@ -309,6 +309,18 @@ TEST(fq12, UnitaryInverse)
     EXPECT_EQ(result.c1, fq6::zero());
 }
 
+TEST(fq12, CyclotomicSquared)
+{
+    // Map a random element into the cyclotomic subgroup with the easy part of the final exponentiation
+    fq12 input = fq12::random_element();
+    input = input.unitary_inverse() * input.invert();
+    input = input * input.frobenius_map_two();
+
+    fq12 result = input.cyclotomic_squared();
+    fq12 expected = input.sqr();
+    EXPECT_EQ(result, expected);
+}
+
 TEST(fq12, FrobeniusMapThree)
 {
     fq12 a = { { { { 0x9a56f1e63b1f0db8, 0xd629a6c847f6cedd, 0x4a179c053a91458b, 0xa84c02b0b6d7470 },
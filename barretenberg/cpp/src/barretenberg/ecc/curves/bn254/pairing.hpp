@@ -40,6 +40,8 @@ constexpr fq12 miller_loop(const g1::element& P, const miller_lines& lines);
 
 constexpr fq12 miller_loop_batch(const g1::element* points, const miller_lines* lines, size_t num_pairs);
 
+inline fq12 miller_loop_batch_parallel(const g1::element* points, const miller_lines* lines, size_t num_pairs);
+
 constexpr void final_exponentiation_easy_part(const fq12& elt, fq12& r);
 
 constexpr void final_exponentiation_exp_by_neg_z(const fq12& elt, fq12& r);
@@ -3,10 +3,14 @@
 #include "./fq12.hpp"
 #include "./g1.hpp"
 #include "./g2.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 
 namespace barretenberg::pairing {
 constexpr fq two_inv = fq(2).invert();
+// Minimum number of pairs handed to a thread by the parallel Miller loop. A single pair's Miller loop already outweighs
+// the cost of dispatching it and of the one extra fq12 multiplication needed to combine its result.
+constexpr size_t miller_loop_grain_size = 1;
 inline constexpr g2::element mul_by_q(const g2::element& a)
 {
 
@@ -202,6 +206,24 @@ constexpr fq12 miller_loop_batch(const g1::element* points, const miller_lines*
     return work_scalar;
 }
 
+/**
+ * @brief Miller loop over a batch of pairs, with the pairs split across threads
+ *
+ * @details The Miller loop of a product of pairings is the product of the Miller loops of its factors, so each thread
+ * runs miller_loop_batch over a contiguous chunk of the pairs (sharing the fq12 squarings within its chunk) and the
+ * partial results are multiplied together.
+ */
+inline fq12 miller_loop_batch_parallel(const g1::element* points, const miller_lines* lines, const size_t num_pairs)
+{
+    return parallel_reduce(
+        0,
+        num_pairs,
+        miller_loop_grain_size,
+        fq12::one(),
+        [&](size_t start, size_t end) { return miller_loop_batch(points + start, lines + start, end - start); },
+        [](const fq12& accumulator, const fq12& partial) { return accumulator * partial; });
+}
+
 constexpr fq12 final_exponentiation_easy_part(const fq12& elt)
 {
     fq12 a{ elt.c0, -elt.c1 };
@@ -271,7 +293,7 @@ fq12 reduced_ate_pairing_batch_precomputed(const g1::affine_element* P_affines,
     for (size_t i = 0; i < num_points; ++i) {
         P[i] = g1::element(P_affines[i]);
     }
-    fq12 result = miller_loop_batch(&P[0], &lines[0], num_points);
+    fq12 result = miller_loop_batch_parallel(&P[0], &lines[0], num_points);
     result = final_exponentiation_easy_part(result);
     result = final_exponentiation_tricky_part(result);
     return result;
@@ -285,14 +307,14 @@ fq12 reduced_ate_pairing_batch(const g1::affine_element* P_affines,
     std::vector<g2::element> Q(num_points);
     std::vector<miller_lines> lines(num_points);
 
-    for (size_t i = 0; i < num_points; ++i) {
+    parallel_for_range(0, num_points, miller_loop_grain_size, [&](size_t i) {
         P[i] = g1::element(P_affines[i]);
         Q[i] = g2::element(Q_affines[i]);
 
         precompute_miller_lines(Q[i], lines[i]);
-    }
+    });
 
-    fq12 result = miller_loop_batch(&P[0], &lines[0], num_points);
+    fq12 result = miller_loop_batch_parallel(&P[0], &lines[0], num_points);
     result = final_exponentiation_easy_part(result);
     result = final_exponentiation_tricky_part(result);
     return result;
@@ -223,11 +223,55 @@ template <typename quadratic_field, typename base_field, typename Fq12Params> cl
         };
     }
 
+    /**
+     * @brief Squaring of an element of the cyclotomic subgroup, i.e. of the output of the easy part of the final
+     * exponentiation.
+     *
+     * @details From "Faster Squaring in the Cyclotomic Subgroup of Sixth Degree Extensions" (Granger, Scott); Section
+     * 3.2. Viewing the element as three fq4 coefficients (c0.c0, c1.c1), (c1.c0, c0.c2), (c0.c1, c1.c2), a cyclotomic
+     * square takes three fq4 squarings, i.e. six fq2 multiplications against twelve for the generic square.
+     * The result is only correct for elements of the cyclotomic subgroup.
+     */
     constexpr field12 cyclotomic_squared() const
     {
-        // Possible Optimization: The cyclotomic squaring can be implemented more than efficiently
-        // than the generic squaring.
-        return sqr();
+        // (t0 + t1.y) = (c0.c0 + c1.c1.y)^2, where y^2 = the fq6 non-residue
+        quadratic_field tmp = c0.c0 * c1.c1;
+        quadratic_field t0 = (c0.c0 + c1.c1) * (base_field::mul_by_non_residue(c1.c1) + c0.c0) - tmp -
+                             base_field::mul_by_non_residue(tmp);
+        quadratic_field t1 = tmp + tmp;
+
+        // (t2 + t3.y) = (c1.c0 + c0.c2.y)^2
+        tmp = c1.c0 * c0.c2;
+        quadratic_field t2 = (c1.c0 + c0.c2) * (base_field::mul_by_non_residue(c0.c2) + c1.c0) - tmp -
+                             base_field::mul_by_non_residue(tmp);
+        quadratic_field t3 = tmp + tmp;
+
+        // (t4 + t5.y) = (c0.c1 + c1.c2.y)^2
+        tmp = c0.c1 * c1.c2;
+        quadratic_field t4 = (c0.c1 + c1.c2) * (base_field::mul_by_non_residue(c1.c2) + c0.c1) - tmp -
+                             base_field::mul_by_non_residue(tmp);
+        quadratic_field t5 = tmp + tmp;
+
+        field12 result;
+        // c0.c0 = 3.t0 - 2.c0.c0, c1.c1 = 3.t1 + 2.c1.c1
+        tmp = t0 - c0.c0;
+        result.c0.c0 = tmp + tmp + t0;
+        tmp = t1 + c1.c1;
+        result.c1.c1 = tmp + tmp + t1;
+
+        // c1.c0 = 3.(t5 * non-residue) + 2.c1.c0, c0.c2 = 3.t4 - 2.c0.c2
+        const quadratic_field t5_nr = base_field::mul_by_non_residue(t5);
+        tmp = t5_nr + c1.c0;
+        result.c1.c0 = tmp + tmp + t5_nr;
+        tmp = t4 - c0.c2;
+        result.c0.c2 = tmp + tmp + t4;
+
+        // c0.c1 = 3.t2 - 2.c0.c1, c1.c2 = 3.t3 + 2.c1.c2
+        tmp = t2 - c0.c1;
+        result.c0.c1 = tmp + tmp + t2;
+        tmp = t3 + c1.c2;
+        result.c1.c2 = tmp + tmp + t3;
+        return result;
     }
 
     constexpr field12 unitary_inverse() const
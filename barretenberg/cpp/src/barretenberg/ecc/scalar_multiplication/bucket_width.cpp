@@ -0,0 +1,189 @@
+#include "bucket_width.hpp"
+
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/ecc/groups/wnaf.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace barretenberg::scalar_multiplication {
+
+namespace {
+constexpr size_t get_num_rounds_for_bucket_width(const size_t bucket_width)
+{
+    return WNAF_SIZE(bucket_width + 1);
+}
+
+// Profiles are never modified or freed once set, so `get_optimal_bucket_width` can read the active one through a
+// plain atomic pointer load. Only calibration and tests swap profiles, so the retired ones take next to no memory.
+std::mutex profiles_mutex;
+std::vector<std::unique_ptr<const bucket_width_profile>> profiles;
+
+const bucket_width_profile* retain_profile(const std::optional<bucket_width_profile>& profile)
+{
+    if (!profile) {
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> lock(profiles_mutex);
+    profiles.push_back(std::make_unique<const bucket_width_profile>(*profile));
+    return profiles.back().get();
+}
+
+// Reads the profile named by BB_PIPPENGER_PROFILE, if there is one
+const bucket_width_profile* load_env_profile()
+{
+    const char* env_path = std::getenv("BB_PIPPENGER_PROFILE");
+    if (env_path == nullptr || *env_path == 0) {
+        return nullptr;
+    }
+    auto profile = load_bucket_width_profile(env_path);
+    if (!profile) {
+        info("could not read a pippenger bucket width profile from ", env_path, ", using the default widths");
+    }
+    return retain_profile(profile);
+}
+
+std::atomic<const bucket_width_profile*>& active_profile()
+{
+    // Picks up the environment's profile on first use; an explicitly set profile replaces it
+    static std::atomic<const bucket_width_profile*> profile{ load_env_profile() };
+    return profile;
+}
+} // namespace
+
+bucket_width_profile::bucket_width_profile()
+    : bucket_widths()
+{
+    for (size_t i = 0; i < MAX_LOG_NUM_POINTS; ++i) {
+        bucket_widths[i] = static_cast<uint8_t>(get_default_bucket_width(1ULL << i));
+    }
+}
+
+size_t bucket_width_profile::get_bucket_width(const size_t num_points) const
+{
+    if (num_points == 0) {
+        return bucket_widths[0];
+    }
+    return bucket_widths[std::min(static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_points))),
+                                  MAX_LOG_NUM_POINTS - 1)];
+}
+
+void bucket_width_profile::set_bucket_width_for_log_size(const size_t log_num_points, const size_t bucket_width)
+{
+    bucket_widths[log_num_points] =
+        static_cast<uint8_t>(std::clamp(bucket_width, MIN_BUCKET_WIDTH, MAX_BUCKET_WIDTH));
+}
+
+void bucket_width_profile::normalize()
+{
+    for (size_t i = 0; i < MAX_LOG_NUM_POINTS; ++i) {
+        bucket_widths[i] = static_cast<uint8_t>(
+            std::clamp(static_cast<size_t>(bucket_widths[i]), MIN_BUCKET_WIDTH, MAX_BUCKET_WIDTH));
+        if (i > 0) {
+            bucket_widths[i] = std::max(bucket_widths[i], bucket_widths[i - 1]);
+        }
+    }
+    // Widen the smaller sizes until halving the MSM size at most doubles the round count. Widening entry i can only
+    // tighten the constraint on entry i - 1, so a single descending pass suffices
+    for (size_t i = MAX_LOG_NUM_POINTS - 1; i > 0; --i) {
+        while (get_num_rounds_for_bucket_width(bucket_widths[i - 1]) >
+               2 * get_num_rounds_for_bucket_width(bucket_widths[i])) {
+            ++bucket_widths[i - 1];
+        }
+    }
+}
+
+bool bucket_width_profile::is_normalized() const
+{
+    bucket_width_profile normalized = *this;
+    normalized.normalize();
+    return normalized == *this;
+}
+
+std::string bucket_width_profile::to_string() const
+{
+    std::ostringstream ss;
+    ss << "# pippenger bucket widths: <log2 num points> <bucket width>\n";
+    for (size_t i = 0; i < MAX_LOG_NUM_POINTS; ++i) {
+        ss << i << " " << static_cast<size_t>(bucket_widths[i]) << "\n";
+    }
+    return ss.str();
+}
+
+std::optional<bucket_width_profile> bucket_width_profile::from_string(const std::string& str)
+{
+    bucket_width_profile profile;
+    std::istringstream lines(str);
+    std::string line;
+    while (std::getline(lines, line)) {
+        line = line.substr(0, line.find('#'));
+        std::istringstream entry(line);
+        size_t log_num_points = 0;
+        size_t bucket_width = 0;
+        if (!(entry >> log_num_points)) {
+            // blank or comment-only line
+            continue;
+        }
+        std::string trailing;
+        if (!(entry >> bucket_width) || (entry >> trailing) || log_num_points >= MAX_LOG_NUM_POINTS ||
+            bucket_width < MIN_BUCKET_WIDTH || bucket_width > MAX_BUCKET_WIDTH) {
+            return std::nullopt;
+        }
+        profile.bucket_widths[log_num_points] = static_cast<uint8_t>(bucket_width);
+    }
+    profile.normalize();
+    return profile;
+}
+
+std::optional<bucket_width_profile> load_bucket_width_profile(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file) {
+        return std::nullopt;
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return bucket_width_profile::from_string(contents.str());
+}
+
+bool save_bucket_width_profile(const std::string& path, const bucket_width_profile& profile)
+{
+    std::ofstream file(path);
+    if (!file) {
+        return false;
+    }
+    file << profile.to_string();
+    return static_cast<bool>(file);
+}
+
+void set_bucket_width_profile(const std::optional<bucket_width_profile>& profile)
+{
+    active_profile().store(retain_profile(profile), std::memory_order_release);
+}
+
+std::optional<bucket_width_profile> get_bucket_width_profile()
+{
+    const bucket_width_profile* profile = active_profile().load(std::memory_order_acquire);
+    if (profile == nullptr) {
+        return std::nullopt;
+    }
+    return *profile;
+}
+
+size_t get_optimal_bucket_width(const size_t num_points)
+{
+    const bucket_width_profile* profile = active_profile().load(std::memory_order_acquire);
+    if (profile == nullptr) {
+        return get_default_bucket_width(num_points);
+    }
+    return profile->get_bucket_width(num_points);
+}
+
+} // namespace barretenberg::scalar_multiplication
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace barretenberg::scalar_multiplication {
+
+/**
+ * The bucket widths we use when no calibrated profile is active. This threshold ladder was tuned on a single machine;
+ * hosts with different cache sizes and core counts can do noticeably better with a calibrated `bucket_width_profile`.
+ **/
+constexpr size_t get_default_bucket_width(const size_t num_points)
+{
+    if (num_points >= 14617149) {
+        return 21;
+    }
+    if (num_points >= 1139094) {
+        return 18;
+    }
+    // if (num_points >= 100000)
+    if (num_points >= 155975) {
+        return 15;
+    }
+    if (num_points >= 144834)
+    // if (num_points >= 100000)
+    {
+        return 14;
+    }
+    if (num_points >= 25067) {
+        return 12;
+    }
+    if (num_points >= 13926) {
+        return 11;
+    }
+    if (num_points >= 7659) {
+        return 10;
+    }
+    if (num_points >= 2436) {
+        return 9;
+    }
+    if (num_points >= 376) {
+        return 7;
+    }
+    if (num_points >= 231) {
+        return 6;
+    }
+    if (num_points >= 97) {
+        return 5;
+    }
+    if (num_points >= 35) {
+        return 4;
+    }
+    if (num_points >= 10) {
+        return 3;
+    }
+    if (num_points >= 2) {
+        return 2;
+    }
+    return 1;
+}
+
+/**
+ * @brief A table of Pippenger bucket widths, indexed by the log2 of the number of points in the MSM.
+ *
+ * @details `pippenger` only ever evaluates power-of-two sized slices (see `pippenger_internal`), so one width per
+ * power of two is all the resolution we need. Profiles are produced by `calibrate_bucket_widths`, persisted as text
+ * (one `<log2 num points> <bucket width>` pair per line, `#` starts a comment) and loaded at startup from the file
+ * named by the `BB_PIPPENGER_PROFILE` environment variable.
+ *
+ * A pippenger_runtime_state sized for n points is also used for smaller MSMs, so its buffers must be large enough for
+ * every smaller slice too. `normalize` enforces the two properties this relies on: widths never decrease as the MSM
+ * grows, and halving the MSM size at most doubles the number of pippenger rounds.
+ */
+class bucket_width_profile {
+  public:
+    static constexpr size_t MAX_LOG_NUM_POINTS = 32;
+    static constexpr size_t MIN_BUCKET_WIDTH = 1;
+    static constexpr size_t MAX_BUCKET_WIDTH = 22;
+
+    // Constructs a profile holding the default widths, sampled at each power of two
+    bucket_width_profile();
+
+    size_t get_bucket_width(size_t num_points) const;
+    size_t get_bucket_width_for_log_size(size_t log_num_points) const { return bucket_widths[log_num_points]; }
+    void set_bucket_width_for_log_size(size_t log_num_points, size_t bucket_width);
+
+    void normalize();
+    bool is_normalized() const;
+
+    std::string to_string() const;
+    // Entries missing from `str` keep their default widths. The result is normalized
+    static std::optional<bucket_width_profile> from_string(const std::string& str);
+
+    bool operator==(const bucket_width_profile& other) const = default;
+
+  private:
+    std::array<uint8_t, MAX_LOG_NUM_POINTS> bucket_widths;
+};
+
+// Reads (or writes) a profile in the `bucket_width_profile::to_string` format
+std::optional<bucket_width_profile> load_bucket_width_profile(const std::string& path);
+bool save_bucket_width_profile(const std::string& path, const bucket_width_profile& profile);
+
+/**
+ * Replaces (or, with std::nullopt, clears) the profile used by `get_optimal_bucket_width`. Must not be called while an
+ * MSM is in flight. Pooled runtime states that were sized for the old widths are rebuilt on demand, but a
+ * pippenger_runtime_state the caller owns should be constructed after the profile is set.
+ */
+void set_bucket_width_profile(const std::optional<bucket_width_profile>& profile);
+std::optional<bucket_width_profile> get_bucket_width_profile();
+
+// The bucket width pippenger uses for an MSM of `num_points` points: taken from the active profile if one is set, or
+// from `get_default_bucket_width` otherwise
+size_t get_optimal_bucket_width(size_t num_points);
+
+} // namespace barretenberg::scalar_multiplication
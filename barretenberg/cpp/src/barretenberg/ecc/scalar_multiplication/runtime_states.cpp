@@ -36,7 +36,7 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial
     , scratch_space(reinterpret_cast<Fq*>(scratch_space_ptr.get()))
     , skew_table(reinterpret_cast<bool*>(aligned_alloc(64, pad(static_cast<size_t>(num_points) * sizeof(bool), 64))))
     , bucket_counts(reinterpret_cast<uint32_t*>(aligned_alloc(64, num_threads * num_buckets * sizeof(uint32_t))))
-    , bit_counts(reinterpret_cast<uint32_t*>(aligned_alloc(64, num_threads * num_buckets * sizeof(uint32_t))))
+    , bit_counts(reinterpret_cast<uint32_t*>(aligned_alloc(64, num_threads * NUM_BIT_COUNTS * sizeof(uint32_t))))
     , bucket_empty_status(reinterpret_cast<bool*>(aligned_alloc(64, num_threads * num_buckets * sizeof(bool))))
     , round_counts(reinterpret_cast<uint64_t*>(aligned_alloc(32, MAX_NUM_ROUNDS * sizeof(uint64_t))))
 {
@@ -52,12 +52,13 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial
     const size_t points_per_thread = static_cast<size_t>(num_points) / num_threads;
     parallel_for(num_threads, [&](size_t i) {
         const size_t thread_offset = i * points_per_thread;
-        memset(reinterpret_cast<void*>(point_pairs_1 + thread_offset + (i * 16)),
+        const size_t point_pairs_offset = i * (2 * points_per_thread + 16);
+        memset(reinterpret_cast<void*>(point_pairs_1 + point_pairs_offset),
                0,
-               (points_per_thread + 16) * sizeof(AffineElement));
-        memset(reinterpret_cast<void*>(point_pairs_2 + thread_offset + (i * 16)),
+               (2 * points_per_thread + 16) * sizeof(AffineElement));
+        memset(reinterpret_cast<void*>(point_pairs_2 + point_pairs_offset),
                0,
-               (points_per_thread + 16) * sizeof(AffineElement));
+               (2 * points_per_thread + 16) * sizeof(AffineElement));
         memset(reinterpret_cast<void*>(scratch_space + thread_offset), 0, (points_per_thread) * sizeof(Fq));
         for (size_t j = 0; j < num_rounds; ++j) {
             const size_t round_offset = (j * static_cast<size_t>(num_points));
@@ -69,7 +70,7 @@ pippenger_runtime_state<Curve>::pippenger_runtime_state(const size_t num_initial
     });
 
     memset(reinterpret_cast<void*>(bucket_counts), 0, num_threads * num_buckets * sizeof(uint32_t));
-    memset(reinterpret_cast<void*>(bit_counts), 0, num_threads * num_buckets * sizeof(uint32_t));
+    memset(reinterpret_cast<void*>(bit_counts), 0, num_threads * NUM_BIT_COUNTS * sizeof(uint32_t));
     memset(reinterpret_cast<void*>(bucket_empty_status), 0, num_threads * num_buckets * sizeof(bool));
     memset(reinterpret_cast<void*>(round_counts), 0, MAX_NUM_ROUNDS * sizeof(uint64_t));
 }
@@ -157,6 +158,8 @@ pippenger_runtime_state<Curve>& pippenger_runtime_state<Curve>::operator=(
     other.round_counts = nullptr;
 
     num_points = other.num_points;
+    num_buckets = other.num_buckets;
+    num_rounds = other.num_rounds;
     return *this;
 }
 
@@ -165,20 +168,37 @@ affine_product_runtime_state<Curve> pippenger_runtime_state<Curve>::get_affine_p
     const size_t num_threads, const size_t thread_index)
 {
     const auto points_per_thread = static_cast<size_t>(num_points / num_threads);
-    const auto num_buckets =
-        static_cast<size_t>(1U << scalar_multiplication::get_optimal_bucket_width(static_cast<size_t>(num_points) / 2));
 
     scalar_multiplication::affine_product_runtime_state<Curve> product_state;
 
-    product_state.point_pairs_1 = point_pairs_1 + (thread_index * points_per_thread) + (thread_index * 16);
-    product_state.point_pairs_2 = point_pairs_2 + (thread_index * points_per_thread) + (thread_index * 16);
-    product_state.scratch_space = scratch_space + (thread_index * (points_per_thread / 2));
+    // A thread's schedule slice is bucket-aligned (see `get_bucket_aligned_thread_offset`) and can hold up to ~1.5x
+    // `points_per_thread` entries, so each thread gets twice its nominal share of the (2x sized) point pair and
+    // scratch buffers
+    product_state.point_pairs_1 = point_pairs_1 + (thread_index * (2 * points_per_thread + 16));
+    product_state.point_pairs_2 = point_pairs_2 + (thread_index * (2 * points_per_thread + 16));
+    product_state.scratch_space = scratch_space + (thread_index * points_per_thread);
     product_state.bucket_counts = bucket_counts + (thread_index * (num_buckets));
-    product_state.bit_offsets = bit_counts + (thread_index * (num_buckets));
+    product_state.bit_offsets = bit_counts + (thread_index * NUM_BIT_COUNTS);
     product_state.bucket_empty_status = bucket_empty_status + (thread_index * (num_buckets));
     return product_state;
 }
 
+template <typename Curve> bool pippenger_runtime_state<Curve>::can_serve(const size_t num_initial_points) const
+{
+    if (num_initial_points * 2 > num_points) {
+        return false;
+    }
+    if (num_initial_points == 0) {
+        return true;
+    }
+    const size_t required_num_buckets =
+        static_cast<size_t>(1ULL << get_optimal_bucket_width(static_cast<size_t>(num_initial_points)));
+    const size_t required_point_schedule_size =
+        num_initial_points * 2 * get_num_pippenger_rounds(num_initial_points * 2);
+    return required_num_buckets <= num_buckets &&
+           required_point_schedule_size <= static_cast<size_t>(num_points) * num_rounds;
+}
+
 template <typename Curve> pippenger_runtime_state<Curve>::~pippenger_runtime_state() noexcept
 {
     if (skew_table != nullptr) {
@@ -202,10 +222,54 @@ template <typename Curve> pippenger_runtime_state<Curve>::~pippenger_runtime_sta
     }
 }
 
+template <typename Curve>
+typename pippenger_runtime_state_pool<Curve>::handle pippenger_runtime_state_pool<Curve>::acquire(
+    const size_t num_initial_points)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        // Best fit: the smallest idle state whose buffers are large enough. `num_points` counts endomorphism points.
+        auto best = idle_states.end();
+        for (auto it = idle_states.begin(); it != idle_states.end(); ++it) {
+            if ((*it)->can_serve(num_initial_points) &&
+                (best == idle_states.end() || (*it)->num_points < (*best)->num_points)) {
+                best = it;
+            }
+        }
+        if (best != idle_states.end()) {
+            auto* state = best->release();
+            idle_states.erase(best);
+            return handle(state, releaser{ this });
+        }
+    }
+    // Construct outside of the lock, this is the expensive part.
+    return handle(new pippenger_runtime_state<Curve>(num_initial_points), releaser{ this });
+}
+
+template <typename Curve> void pippenger_runtime_state_pool<Curve>::release(pippenger_runtime_state<Curve>* state)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    idle_states.emplace_back(state);
+}
+
+template <typename Curve> void pippenger_runtime_state_pool<Curve>::clear()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    idle_states.clear();
+}
+
+template <typename Curve> size_t pippenger_runtime_state_pool<Curve>::num_idle_states()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    return idle_states.size();
+}
+
 template struct affine_product_runtime_state<curve::BN254>;
 template struct affine_product_runtime_state<curve::Grumpkin>;
 template struct pippenger_runtime_state<curve::BN254>;
 template struct pippenger_runtime_state<curve::Grumpkin>;
+template class pippenger_runtime_state_pool<curve::BN254>;
+template class pippenger_runtime_state_pool<curve::Grumpkin>;
 } // namespace barretenberg::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -1,63 +1,18 @@
 #pragma once
 
+#include "./bucket_width.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/groups/wnaf.hpp"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace barretenberg::scalar_multiplication {
 // simple helper functions to retrieve pointers to pre-allocated memory for the scalar multiplication algorithm.
 // This is to eliminate page faults when allocating (and writing) to large tranches of memory.
-constexpr size_t get_optimal_bucket_width(const size_t num_points)
-{
-    if (num_points >= 14617149) {
-        return 21;
-    }
-    if (num_points >= 1139094) {
-        return 18;
-    }
-    // if (num_points >= 100000)
-    if (num_points >= 155975) {
-        return 15;
-    }
-    if (num_points >= 144834)
-    // if (num_points >= 100000)
-    {
-        return 14;
-    }
-    if (num_points >= 25067) {
-        return 12;
-    }
-    if (num_points >= 13926) {
-        return 11;
-    }
-    if (num_points >= 7659) {
-        return 10;
-    }
-    if (num_points >= 2436) {
-        return 9;
-    }
-    if (num_points >= 376) {
-        return 7;
-    }
-    if (num_points >= 231) {
-        return 6;
-    }
-    if (num_points >= 97) {
-        return 5;
-    }
-    if (num_points >= 35) {
-        return 4;
-    }
-    if (num_points >= 10) {
-        return 3;
-    }
-    if (num_points >= 2) {
-        return 2;
-    }
-    return 1;
-}
-
-constexpr size_t get_num_rounds(const size_t num_points)
+inline size_t get_num_rounds(const size_t num_points)
 {
     const size_t bits_per_bucket = get_optimal_bucket_width(num_points / 2);
     return WNAF_SIZE(bits_per_bucket + 1);
@@ -81,6 +36,9 @@ template <typename Curve> struct pippenger_runtime_state {
     using AffineElement = typename Curve::AffineElement;
 
     static constexpr size_t MAX_NUM_ROUNDS = 256;
+    // `reduce_buckets` keeps one offset per bit of a bucket count, so each thread's slice of `bit_counts` must be this
+    // long however few buckets there are
+    static constexpr size_t NUM_BIT_COUNTS = 32;
     uint64_t num_points;
     size_t num_buckets;
     size_t num_rounds;
@@ -112,10 +70,55 @@ template <typename Curve> struct pippenger_runtime_state {
     pippenger_runtime_state(pippenger_runtime_state& other) = delete;
 
     affine_product_runtime_state<Curve> get_affine_product_runtime_state(size_t num_threads, size_t thread_index);
+
+    // Whether this state's buffers are large enough for an MSM of `num_initial_points` points under the current
+    // bucket widths. They may not be if the bucket width profile changed after the state was constructed.
+    bool can_serve(size_t num_initial_points) const;
+};
+
+/**
+ * @brief A thread-safe cache of pippenger_runtime_states, so that back-to-back MSMs reuse warm scratch memory.
+ *
+ * @details Building a pippenger_runtime_state allocates (and touches, to take the page faults up front) several buffers
+ * proportional to the number of points. The pool keeps released states alive and hands them out again: `acquire(n)`
+ * returns the smallest idle state that can serve an MSM of size n, or builds a new one if none is idle. A state can
+ * only be used by one MSM at a time, so concurrent MSMs each receive their own state.
+ *
+ * The returned handle gives the state back to the pool when it goes out of scope. The pool must outlive its handles.
+ */
+template <typename Curve> class pippenger_runtime_state_pool {
+  public:
+    struct releaser {
+        pippenger_runtime_state_pool* pool;
+        void operator()(pippenger_runtime_state<Curve>* state) const { pool->release(state); }
+    };
+    using handle = std::unique_ptr<pippenger_runtime_state<Curve>, releaser>;
+
+    pippenger_runtime_state_pool() = default;
+    pippenger_runtime_state_pool(const pippenger_runtime_state_pool& other) = delete;
+    pippenger_runtime_state_pool(pippenger_runtime_state_pool&& other) = delete;
+    pippenger_runtime_state_pool& operator=(const pippenger_runtime_state_pool& other) = delete;
+    pippenger_runtime_state_pool& operator=(pippenger_runtime_state_pool&& other) = delete;
+    ~pippenger_runtime_state_pool() = default;
+
+    handle acquire(size_t num_initial_points);
+
+    // Drop all idle states, returning their memory.
+    void clear();
+
+    size_t num_idle_states();
+
+  private:
+    void release(pippenger_runtime_state<Curve>* state);
+
+    std::mutex mutex;
+    std::vector<std::unique_ptr<pippenger_runtime_state<Curve>>> idle_states;
 };
 
 extern template struct affine_product_runtime_state<curve::BN254>;
 extern template struct affine_product_runtime_state<curve::Grumpkin>;
 extern template struct pippenger_runtime_state<curve::BN254>;
 extern template struct pippenger_runtime_state<curve::Grumpkin>;
+extern template class pippenger_runtime_state_pool<curve::BN254>;
+extern template class pippenger_runtime_state_pool<curve::Grumpkin>;
 } // namespace barretenberg::scalar_multiplication
@@ -1,9 +1,15 @@
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <span>
+#include <vector>
 
+#include "./bucket_width.hpp"
+#include "./point_table.hpp"
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 #include "./scalar_multiplication.hpp"
@@ -273,6 +279,54 @@ void organize_buckets(uint64_t* point_schedule, const size_t num_points)
     });
 }
 
+/**
+ * Returns where thread `thread_index` of `num_threads` starts reading a bucket-sorted schedule of `num_entries`
+ * entries (thread `num_threads` "starts" at `num_entries`, so thread j reads [offset(j), offset(j + 1))).
+ *
+ * Each thread's nominal start, j * (num_entries / num_threads), is pushed forward past the end of the bucket it lands
+ * in, so each bucket is normally reduced by a single thread rather than as two partial sums. We give up after half a
+ * slice so a single huge bucket cannot pile all of the work onto one thread; that bucket is then split as before
+ * (partial bucket sums still add up correctly in the running sums). Every thread therefore reads at most 1.5x its
+ * nominal share (plus the leftovers for the last thread), which `get_affine_product_runtime_state` leaves room for.
+ *
+ * With fewer entries than threads, everything goes to the last thread.
+ **/
+size_t get_bucket_aligned_thread_offset(const uint64_t* point_schedule,
+                                        const size_t num_entries,
+                                        const size_t num_threads,
+                                        const size_t thread_index)
+{
+    if (thread_index >= num_threads) {
+        return num_entries;
+    }
+    const size_t num_entries_per_thread = num_entries / num_threads;
+    const size_t nominal_offset = thread_index * num_entries_per_thread;
+    if (nominal_offset == 0) {
+        return 0;
+    }
+    const uint64_t bucket = point_schedule[nominal_offset - 1] & 0x7fffffffU;
+    const size_t search_limit = std::min(nominal_offset + num_entries_per_thread / 2, num_entries);
+    const uint64_t* it =
+        std::partition_point(&point_schedule[nominal_offset],
+                             &point_schedule[search_limit],
+                             [bucket](const uint64_t entry) { return (entry & 0x7fffffffU) == bucket; });
+    return static_cast<size_t>(it - point_schedule);
+}
+
+/**
+ * Adds up the per-thread accumulators of a pippenger round. There is one per thread, so this is a handful of point
+ * additions: they are folded on the calling thread, as dispatching them to the pool would cost more than they do.
+ **/
+template <typename Element> Element sum_thread_accumulators(std::span<const Element> accumulators)
+{
+    Element result;
+    result.self_set_infinity();
+    for (const Element& accumulator : accumulators) {
+        result += accumulator;
+    }
+    return result;
+}
+
 /**
  * adds a bunch of points together using affine addition formulae.
  * Paradoxically, the affine formula is crazy efficient if you have a lot of independent point additions to perform.
@@ -752,33 +806,37 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
     std::unique_ptr<Element[], decltype(&aligned_free)> thread_accumulators(
         static_cast<Element*>(aligned_alloc(64, num_threads * sizeof(Element))), &aligned_free);
 
+    // `reduce_buckets` rewrites each thread's schedule slice in place, so the slice boundaries have to be found before
+    // any thread starts
+    std::vector<size_t> thread_offsets(num_rounds * (num_threads + 1));
+    for (size_t i = 0; i < num_rounds; ++i) {
+        for (size_t j = 0; j <= num_threads; ++j) {
+            thread_offsets[i * (num_threads + 1) + j] = get_bucket_aligned_thread_offset(
+                &state.point_schedule[i * num_points], state.round_counts[i], num_threads, j);
+        }
+    }
+
     parallel_for(num_threads, [&](size_t j) {
         thread_accumulators[j].self_set_infinity();
 
         for (size_t i = 0; i < num_rounds; ++i) {
 
-            const uint64_t num_round_points = state.round_counts[i];
-
             Element accumulator;
             accumulator.self_set_infinity();
 
-            if ((num_round_points == 0) || (num_round_points < num_threads && j != num_threads - 1)) {
-            } else {
-
-                const uint64_t num_round_points_per_thread = num_round_points / num_threads;
-                const uint64_t leftovers =
-                    (j == num_threads - 1) ? (num_round_points) - (num_round_points_per_thread * num_threads) : 0;
+            uint64_t* round_point_schedule = &state.point_schedule[i * num_points];
+            const size_t thread_start = thread_offsets[i * (num_threads + 1) + j];
+            const size_t thread_end = thread_offsets[i * (num_threads + 1) + j + 1];
 
-                uint64_t* thread_point_schedule =
-                    &state.point_schedule[(i * num_points) + j * num_round_points_per_thread];
+            if (thread_start != thread_end) {
+                uint64_t* thread_point_schedule = &round_point_schedule[thread_start];
                 const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
-                const size_t last_bucket =
-                    thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
+                const size_t last_bucket = thread_point_schedule[thread_end - thread_start - 1] & 0x7fffffffU;
                 const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
 
                 affine_product_runtime_state<Curve> product_state =
                     state.get_affine_product_runtime_state(num_threads, j);
-                product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
+                product_state.num_points = static_cast<uint32_t>(thread_end - thread_start);
                 product_state.points = points;
                 product_state.point_schedule = thread_point_schedule;
                 product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
@@ -846,12 +904,7 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
         }
     });
 
-    Element result;
-    result.self_set_infinity();
-    for (size_t i = 0; i < num_threads; ++i) {
-        result += thread_accumulators[i];
-    }
-    return result;
+    return sum_thread_accumulators<Element>({ thread_accumulators.get(), num_threads });
 }
 
 template <typename Curve>
@@ -939,8 +992,12 @@ template <typename Curve>
 typename Curve::Element pippenger_unsafe(typename Curve::ScalarField* scalars,
                                          typename Curve::AffineElement* points,
                                          const size_t num_initial_points,
-                                         pippenger_runtime_state<Curve>& state)
+                                         pippenger_runtime_state<Curve>& state,
+                                         msm_engine engine)
 {
+    if (engine == msm_engine::signed_digit) {
+        return pippenger_signed_digit(scalars, points, num_initial_points, state, false);
+    }
     return pippenger(scalars, points, num_initial_points, state, false);
 }
 
@@ -955,6 +1012,753 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
     return pippenger(scalars, &G_mod[0], num_initial_points, state, false);
 }
 
+/**
+ * Recodes each scalar into `num_windows` signed digits of `window_bits` bits, for the signed-digit bucket method.
+ *
+ * Window j of scalar k holds a digit d_j in (-2^{window_bits - 1}, 2^{window_bits - 1}], with k = \sum_j d_j 2^{j *
+ * window_bits}. If the raw window value (plus the carry from the window below) exceeds half the window range, we
+ * subtract 2^{window_bits} from it and carry one into the next window. A digit's magnitude is at most
+ * 2^{window_bits - 1}, so we only need half as many buckets as an unsigned window of the same width, and the sign is
+ * applied for free by negating the point's y-coordinate.
+ *
+ * Digit j of point i is written to `digits[j * num_points + i]`, packed as (sign << 31) | magnitude. Zero digits
+ * (magnitude 0) do not get a schedule entry.
+ **/
+template <typename Curve>
+void compute_signed_digits(uint32_t* digits,
+                           const typename Curve::ScalarField* scalars,
+                           const size_t num_points,
+                           const size_t window_bits)
+{
+    using Fr = typename Curve::ScalarField;
+    const size_t num_windows = get_num_signed_digit_windows<Curve>(window_bits);
+    const uint64_t window_size = 1ULL << window_bits;
+    const uint64_t half_window_size = window_size >> 1;
+
+    parallel_for_range(0, num_points, SIGNED_DIGIT_MIN_POINTS_PER_THREAD, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            const Fr converted = scalars[i].from_montgomery_form();
+            // A spare zero limb, as the top window can extend past the end of the scalar
+            const std::array<uint64_t, 5> limbs{
+                converted.data[0], converted.data[1], converted.data[2], converted.data[3], 0
+            };
+            uint64_t carry = 0;
+            for (size_t j = 0; j < num_windows; ++j) {
+                const uint64_t value = wnaf::get_wnaf_bits(&limbs[0], window_bits, j * window_bits) + carry;
+                carry = static_cast<uint64_t>(value > half_window_size);
+                const uint64_t magnitude = carry ? window_size - value : value;
+                digits[j * num_points + i] = static_cast<uint32_t>((carry << 31) | magnitude);
+            }
+        }
+    });
+}
+
+/**
+ * Builds the point schedule of one signed-digit window: an entry (point index << 32) | (sign << 31) | bucket for
+ * every non-zero digit, sorted by bucket. This is one pass of a radix sort keyed on the bucket index. Each thread
+ * histograms the digits of a contiguous range of points, the histograms are prefix-summed in (bucket, thread) order,
+ * and each thread scatters its entries to their sorted positions.
+ *
+ * Unlike `compute_wnaf_states`, which lays out the schedule of every round up front, we only hold one window's
+ * schedule at a time, so the buffer we sort into is a fraction of the size.
+ *
+ * @return the number of entries in the schedule
+ **/
+size_t organize_signed_digit_schedule(uint64_t* point_schedule,
+                                      const uint32_t* window_digits,
+                                      const size_t num_points,
+                                      const size_t num_buckets,
+                                      std::vector<uint32_t>& thread_bucket_offsets)
+{
+    const size_t num_threads = get_num_cpus_pow2();
+    thread_bucket_offsets.assign(num_threads * num_buckets, 0);
+
+    parallel_for(num_threads, [&](size_t thread_index) {
+        auto [start, end] = get_range_chunk(0, num_points, num_threads, thread_index);
+        uint32_t* bucket_counts = &thread_bucket_offsets[thread_index * num_buckets];
+        for (size_t i = start; i < end; ++i) {
+            const uint32_t magnitude = window_digits[i] & 0x7fffffffU;
+            if (magnitude != 0) {
+                ++bucket_counts[magnitude - 1];
+            }
+        }
+    });
+
+    uint32_t num_entries = 0;
+    for (size_t bucket = 0; bucket < num_buckets; ++bucket) {
+        for (size_t thread_index = 0; thread_index < num_threads; ++thread_index) {
+            uint32_t& offset = thread_bucket_offsets[thread_index * num_buckets + bucket];
+            const uint32_t count = offset;
+            offset = num_entries;
+            num_entries += count;
+        }
+    }
+
+    parallel_for(num_threads, [&](size_t thread_index) {
+        auto [start, end] = get_range_chunk(0, num_points, num_threads, thread_index);
+        uint32_t* bucket_offsets = &thread_bucket_offsets[thread_index * num_buckets];
+        for (size_t i = start; i < end; ++i) {
+            const uint32_t digit = window_digits[i];
+            const uint32_t magnitude = digit & 0x7fffffffU;
+            if (magnitude != 0) {
+                // `points` is a pippenger point table, so point i lives at index 2i
+                point_schedule[bucket_offsets[magnitude - 1]++] =
+                    (static_cast<uint64_t>(i * 2) << 32ULL) | (digit & 0x80000000U) | (magnitude - 1);
+            }
+        }
+    });
+    return num_entries;
+}
+
+/**
+ * Sums the buckets of one signed-digit window, i.e. computes \sum_b (b + 1) * B_b where B_b is the sum of the points
+ * scheduled into bucket b. The schedule is split between threads at bucket boundaries and each thread reduces its
+ * buckets with the affine trick (see `reduce_buckets`), exactly as in `evaluate_pippenger_rounds`.
+ **/
+template <typename Curve>
+typename Curve::Element evaluate_signed_digit_window(pippenger_runtime_state<Curve>& state,
+                                                     typename Curve::AffineElement* points,
+                                                     const size_t num_window_points,
+                                                     bool handle_edge_cases)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+    const size_t num_threads = get_num_cpus_pow2();
+
+    // `reduce_buckets` rewrites each thread's schedule slice in place, so find the slice boundaries up front
+    std::vector<size_t> thread_offsets(num_threads + 1);
+    for (size_t j = 0; j <= num_threads; ++j) {
+        thread_offsets[j] = get_bucket_aligned_thread_offset(state.point_schedule, num_window_points, num_threads, j);
+    }
+
+    std::vector<Element> thread_accumulators(num_threads);
+    parallel_for(num_threads, [&](size_t j) {
+        Element& accumulator = thread_accumulators[j];
+        accumulator.self_set_infinity();
+        const size_t thread_start = thread_offsets[j];
+        const size_t thread_end = thread_offsets[j + 1];
+        if (thread_start == thread_end) {
+            return;
+        }
+
+        uint64_t* thread_point_schedule = &state.point_schedule[thread_start];
+        const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
+        const size_t last_bucket = thread_point_schedule[thread_end - thread_start - 1] & 0x7fffffffU;
+        const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
+
+        affine_product_runtime_state<Curve> product_state = state.get_affine_product_runtime_state(num_threads, j);
+        product_state.num_points = static_cast<uint32_t>(thread_end - thread_start);
+        product_state.points = points;
+        product_state.point_schedule = thread_point_schedule;
+        product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
+        AffineElement* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
+
+        // accumulator = \sum_k k * B_{first_bucket + k}, running_sum = \sum_k B_{first_bucket + k}
+        Element running_sum;
+        running_sum.self_set_infinity();
+        size_t output_it = product_state.num_points - 1;
+        for (size_t k = num_thread_buckets - 1; k > 0; --k) {
+            if (__builtin_expect(!product_state.bucket_empty_status[k], 1)) {
+                running_sum += (output_buckets[output_it]);
+                --output_it;
+            }
+            accumulator += running_sum;
+        }
+        running_sum += output_buckets[0];
+
+        // bucket b holds the digit magnitude b + 1
+        accumulator += running_sum;
+        if (first_bucket > 0) {
+            accumulator += running_sum * Fr(static_cast<uint64_t>(first_bucket));
+        }
+    });
+
+    return sum_thread_accumulators<Element>(thread_accumulators);
+}
+
+/**
+ * A second bucket-method engine, beside the endomorphism + WNAF one in `pippenger`.
+ *
+ * Rather than splitting each scalar into two 128-bit halves over twice as many points, we recode the full scalar into
+ * signed digits (see `compute_signed_digits`) and run one window at a time over the original points. For an MSM of n
+ * points with buckets of the same width, the two engines perform the same number of bucket additions, but here the
+ * point schedule that has to be sorted and streamed through holds n entries of one window, rather than 2n entries for
+ * every round at once. This cuts memory traffic for large (2^20 and up) MSMs, where the full schedule of
+ * `compute_wnaf_states` is far larger than the last level cache.
+ *
+ * `points` is a pippenger point table (as for `pippenger`); only the even entries are read. `state` must be able to
+ * serve `num_initial_points` points.
+ **/
+template <typename Curve>
+typename Curve::Element pippenger_signed_digit(typename Curve::ScalarField* scalars,
+                                               typename Curve::AffineElement* points,
+                                               const size_t num_initial_points,
+                                               pippenger_runtime_state<Curve>& state,
+                                               bool handle_edge_cases)
+{
+    using Element = typename Curve::Element;
+
+    // The naive method is faster for tiny inputs, and shares the endomorphism engine's threshold
+    const size_t threshold = get_num_cpus_pow2() * 8;
+    if (num_initial_points <= threshold) {
+        return pippenger(scalars, points, num_initial_points, state, handle_edge_cases);
+    }
+
+    // Windows one bit wider than the endomorphism engine's WNAF windows need the same 2^bucket_width buckets
+    const size_t window_bits = get_optimal_bucket_width(num_initial_points) + 1;
+    const size_t num_windows = get_num_signed_digit_windows<Curve>(window_bits);
+    const size_t num_buckets = 1ULL << (window_bits - 1);
+
+    auto digits_ptr = get_mem_slab(num_windows * num_initial_points * sizeof(uint32_t));
+    auto* digits = static_cast<uint32_t*>(digits_ptr.get());
+    compute_signed_digits<Curve>(digits, scalars, num_initial_points, window_bits);
+
+    std::vector<uint32_t> thread_bucket_offsets;
+    std::vector<Element> window_sums(num_windows);
+    for (size_t j = 0; j < num_windows; ++j) {
+        const size_t num_window_points = organize_signed_digit_schedule(state.point_schedule,
+                                                                        &digits[j * num_initial_points],
+                                                                        num_initial_points,
+                                                                        num_buckets,
+                                                                        thread_bucket_offsets);
+        window_sums[j] = evaluate_signed_digit_window<Curve>(state, points, num_window_points, handle_edge_cases);
+    }
+
+    Element result = window_sums[num_windows - 1];
+    for (size_t j = num_windows - 1; j > 0; --j) {
+        for (size_t k = 0; k < window_bits; ++k) {
+            result.self_dbl();
+        }
+        result += window_sums[j - 1];
+    }
+    return result;
+}
+
+/**
+ * A multi-scalar multiplication that skips trivial scalars. Prover polynomials are frequently sparse (selectors,
+ * lookup read counts, the ECC op wires are all zero past a small active region), and a lot of their non-zero entries
+ * are ones. Pippenger pays for every scalar regardless of its value, so here we:
+ *
+ * 1: scan the scalars, dropping zeros and summing the points whose scalar is one directly
+ * 2: compact the remaining scalars (and their pippenger point table entries) into contiguous buffers
+ * 3: run Pippenger on the compacted input and add in the sum of the scalar-one points
+ *
+ * If the input turns out to be dense, the compaction isn't worth its memory traffic and we call `pippenger_unsafe`
+ * directly. Same caveats as `pippenger_unsafe` apply: prover only!
+ **/
+template <typename Curve>
+typename Curve::Element pippenger_sparse_unsafe(typename Curve::ScalarField* scalars,
+                                                typename Curve::AffineElement* points,
+                                                const size_t num_initial_points,
+                                                pippenger_runtime_state<Curve>& state)
+{
+    using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    const size_t num_chunks = get_num_range_chunks(0, num_initial_points, SPARSE_MSM_MIN_SCAN_ITERATIONS_PER_THREAD);
+    if (num_chunks == 0) {
+        Element out;
+        out.self_set_infinity();
+        return out;
+    }
+
+    // Count the non-trivial scalars in each chunk, and sum up the points that have a scalar of one
+    std::vector<size_t> chunk_num_kept(num_chunks, 0);
+    std::vector<Element> chunk_ones_sums(num_chunks);
+    parallel_for(num_chunks, [&](size_t chunk) {
+        auto [start, end] = get_range_chunk(0, num_initial_points, num_chunks, chunk);
+        Element ones_sum;
+        ones_sum.self_set_infinity();
+        size_t num_kept = 0;
+        for (size_t i = start; i < end; ++i) {
+            if (scalars[i].is_zero()) {
+                continue;
+            }
+            if (scalars[i] == Fr::one()) {
+                ones_sum += points[i * 2];
+                continue;
+            }
+            ++num_kept;
+        }
+        chunk_num_kept[chunk] = num_kept;
+        chunk_ones_sums[chunk] = ones_sum;
+    });
+
+    Element ones_sum;
+    ones_sum.self_set_infinity();
+    size_t num_kept = 0;
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        ones_sum += chunk_ones_sums[chunk];
+        // convert chunk_num_kept into each chunk's write offset into the compacted buffers
+        const size_t chunk_count = chunk_num_kept[chunk];
+        chunk_num_kept[chunk] = num_kept;
+        num_kept += chunk_count;
+    }
+
+    if (num_kept * SPARSE_MSM_DENSITY_DENOMINATOR > num_initial_points * (SPARSE_MSM_DENSITY_DENOMINATOR - 1)) {
+        // Not sparse enough to be worth compacting. Just skip the trailing zeroes (which are free to drop).
+        size_t num_points = num_initial_points;
+        while (num_points > 0 && scalars[num_points - 1].is_zero()) {
+            --num_points;
+        }
+        return pippenger_unsafe<Curve>(scalars, points, num_points, state);
+    }
+    if (num_kept == 0) {
+        return ones_sum;
+    }
+
+    std::vector<Fr> compacted_scalars(num_kept);
+    auto compacted_point_table = point_table_alloc<AffineElement>(num_kept);
+    AffineElement* compacted_points = compacted_point_table.get();
+    parallel_for(num_chunks, [&](size_t chunk) {
+        auto [start, end] = get_range_chunk(0, num_initial_points, num_chunks, chunk);
+        size_t offset = chunk_num_kept[chunk];
+        for (size_t i = start; i < end; ++i) {
+            if (scalars[i].is_zero() || scalars[i] == Fr::one()) {
+                continue;
+            }
+            compacted_scalars[offset] = scalars[i];
+            compacted_points[offset * 2] = points[i * 2];
+            compacted_points[offset * 2 + 1] = points[i * 2 + 1];
+            ++offset;
+        }
+    });
+
+    return ones_sum + pippenger_unsafe<Curve>(&compacted_scalars[0], compacted_points, num_kept, state);
+}
+
+/**
+ * Evaluates several multi-scalar multiplications over the same pippenger point table as a single Pippenger instance.
+ * Every MSM gets its own range of buckets in a shared point schedule: with a bucket width of c bits for the whole
+ * batch, the entry of MSM m that lands in bucket b goes into bucket m * 2^c + b instead. Each round then sorts and
+ * reduces the buckets of every MSM together, so `reduce_buckets` shares its affine batch inversions over the combined
+ * workload, instead of running one short chain of additions (each paying for its own inversions) per MSM. Finally,
+ * each MSM's bucket range is folded into its round sum as usual.
+ *
+ * Zero scalars are dropped and the points of scalars equal to one are added in directly (see
+ * `pippenger_sparse_unsafe`). Same caveats as `pippenger_unsafe` apply: prover only!
+ **/
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_shared_buckets_unsafe(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars, typename Curve::AffineElement* points)
+{
+    using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    constexpr uint64_t empty_entry = 0xffffffffffffffffULL;
+
+    const size_t num_msms = scalars.size();
+    std::vector<Element> results(num_msms);
+    std::vector<size_t> msm_offsets(num_msms + 1, 0);
+    for (size_t i = 0; i < num_msms; ++i) {
+        results[i].self_set_infinity();
+        msm_offsets[i + 1] = msm_offsets[i] + scalars[i].size();
+    }
+    const size_t num_initial_points = msm_offsets[num_msms];
+    if (num_initial_points == 0) {
+        return results;
+    }
+
+    // Every round adds all of the points into buckets, so the width that suits the average MSM keeps the cost of
+    // folding the buckets of all MSMs in proportion
+    const size_t num_points = num_initial_points * 2;
+    const size_t bits_per_bucket = get_optimal_bucket_width(num_initial_points / num_msms);
+    const size_t wnaf_bits = bits_per_bucket + 1;
+    const size_t num_rounds = WNAF_SIZE(wnaf_bits);
+    const size_t num_msm_buckets = 1UL << bits_per_bucket;
+    const size_t num_buckets = num_msms * num_msm_buckets;
+    // `pippenger_batch_unsafe` splits its MSMs with `get_shared_bucket_msm_groups` to stay within this limit, but the
+    // bucket widths can be swapped out in between
+    if (num_buckets >= BATCH_MSM_MAX_SHARED_BUCKETS) {
+        throw_or_abort("pippenger_shared_buckets_unsafe: too many buckets for one shared point schedule");
+    }
+    const auto bucket_bits = static_cast<uint32_t>(numeric::get_msb(static_cast<uint64_t>(num_buckets)) + 1);
+
+    // `construct_addition_chains` prefetches a few entries past the end of its slice
+    std::vector<uint64_t> point_schedule(num_rounds * num_points + 16);
+
+    // Compute the wnaf entries of each MSM in chunks that do not straddle two MSMs, so that each chunk can sum up the
+    // points of its one scalars and its skew corrections on its own
+    struct chunk {
+        size_t msm;
+        size_t start;
+        size_t end;
+    };
+    std::vector<chunk> chunks;
+    for (size_t i = 0; i < num_msms; ++i) {
+        const size_t msm_size = scalars[i].size();
+        const size_t num_msm_chunks = get_num_range_chunks(0, msm_size, SPARSE_MSM_MIN_SCAN_ITERATIONS_PER_THREAD);
+        for (size_t j = 0; j < num_msm_chunks; ++j) {
+            auto [start, end] = get_range_chunk(0, msm_size, num_msm_chunks, j);
+            chunks.push_back({ i, start, end });
+        }
+    }
+    std::vector<Element> chunk_corrections(chunks.size());
+    std::vector<uint64_t> chunk_round_counts(chunks.size() * num_rounds, 0);
+    parallel_for(chunks.size(), [&](size_t j) {
+        const auto [msm, start, end] = chunks[j];
+        const uint64_t bucket_offset = msm * num_msm_buckets;
+        uint64_t* round_counts = &chunk_round_counts[j * num_rounds];
+        Element correction;
+        correction.self_set_infinity();
+        for (size_t i = start; i < end; ++i) {
+            uint64_t* wnaf_entries = &point_schedule[2 * (msm_offsets[msm] + i)];
+            const Fr& scalar = scalars[msm][i];
+            if (scalar.is_zero() || scalar == Fr::one()) {
+                if (!scalar.is_zero()) {
+                    correction += points[i * 2];
+                }
+                for (size_t k = 0; k < num_rounds; ++k) {
+                    wnaf_entries[k * num_points] = empty_entry;
+                    wnaf_entries[k * num_points + 1] = empty_entry;
+                }
+                continue;
+            }
+
+            Fr T0 = scalar.from_montgomery_form();
+            Fr::split_into_endomorphism_scalars(T0, T0, *(Fr*)&T0.data[2]);
+            bool skew = false;
+            wnaf::fixed_wnaf_with_counts(
+                &T0.data[0], wnaf_entries, skew, round_counts, (i * 2) << 32ULL, num_points, wnaf_bits);
+            if (skew) {
+                correction += -points[i * 2];
+            }
+            wnaf::fixed_wnaf_with_counts(
+                &T0.data[2], wnaf_entries + 1, skew, round_counts, (i * 2 + 1) << 32ULL, num_points, wnaf_bits);
+            if (skew) {
+                correction += -points[i * 2 + 1];
+            }
+
+            // Move the entries into this MSM's range of buckets
+            for (size_t k = 0; k < num_rounds; ++k) {
+                for (size_t l = 0; l < 2; ++l) {
+                    uint64_t& entry = wnaf_entries[k * num_points + l];
+                    if (entry != empty_entry) {
+                        entry += bucket_offset;
+                    }
+                }
+            }
+        }
+        chunk_corrections[j] = correction;
+    });
+
+    std::vector<Element> corrections(num_msms);
+    for (auto& correction : corrections) {
+        correction.self_set_infinity();
+    }
+    std::vector<uint64_t> round_counts(num_rounds, 0);
+    for (size_t j = 0; j < chunks.size(); ++j) {
+        corrections[chunks[j].msm] += chunk_corrections[j];
+        for (size_t k = 0; k < num_rounds; ++k) {
+            round_counts[k] += chunk_round_counts[j * num_rounds + k];
+        }
+    }
+
+    // Sort each round by bucket. Empty entries have every bucket bit set, so they end up past the round's entries
+    parallel_for(num_rounds, [&](size_t i) {
+        process_buckets(&point_schedule[i * num_points], num_points, bucket_bits);
+    });
+
+    const size_t num_threads = get_num_cpus_pow2();
+    std::vector<size_t> thread_offsets(num_rounds * (num_threads + 1));
+    size_t max_thread_points = 0;
+    for (size_t i = 0; i < num_rounds; ++i) {
+        for (size_t j = 0; j <= num_threads; ++j) {
+            thread_offsets[i * (num_threads + 1) + j] = get_bucket_aligned_thread_offset(
+                &point_schedule[i * num_points], round_counts[i], num_threads, j);
+            if (j > 0) {
+                max_thread_points = std::max(max_thread_points,
+                                             thread_offsets[i * (num_threads + 1) + j] -
+                                                 thread_offsets[i * (num_threads + 1) + j - 1]);
+            }
+        }
+    }
+
+    // Scratch space of `reduce_buckets`, for each thread
+    const size_t point_pairs_size = 2 * max_thread_points + 16;
+    std::vector<AffineElement> point_pairs_1(num_threads * point_pairs_size);
+    std::vector<AffineElement> point_pairs_2(num_threads * point_pairs_size);
+    std::vector<typename Curve::BaseField> scratch_space(num_threads * max_thread_points);
+    std::vector<uint32_t> bucket_counts(num_threads * num_buckets);
+    std::vector<uint32_t> bit_offsets(num_threads * 32);
+    std::unique_ptr<bool[]> bucket_empty_status(new bool[num_threads * num_buckets]);
+
+    // A thread's slice can start part way through a bucket whose other part is reduced by the previous thread, so each
+    // thread sets aside the sum of its first bucket, and these are added in once every thread has finished
+    std::vector<AffineElement> bucket_sums(num_buckets);
+    std::vector<uint8_t> bucket_is_set(num_buckets);
+    std::vector<AffineElement> first_bucket_sums(num_threads);
+    std::vector<size_t> first_buckets(num_threads);
+
+    for (size_t i = 0; i < num_rounds; ++i) {
+        std::fill(bucket_is_set.begin(), bucket_is_set.end(), 0);
+        const size_t* round_thread_offsets = &thread_offsets[i * (num_threads + 1)];
+
+        parallel_for(num_threads, [&](size_t j) {
+            const size_t thread_start = round_thread_offsets[j];
+            const size_t thread_end = round_thread_offsets[j + 1];
+            if (thread_start == thread_end) {
+                return;
+            }
+            uint64_t* thread_point_schedule = &point_schedule[i * num_points + thread_start];
+            const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
+            const size_t last_bucket = thread_point_schedule[thread_end - thread_start - 1] & 0x7fffffffU;
+
+            affine_product_runtime_state<Curve> product_state{
+                .points = points,
+                .point_pairs_1 = &point_pairs_1[j * point_pairs_size],
+                .point_pairs_2 = &point_pairs_2[j * point_pairs_size],
+                .scratch_space = &scratch_space[j * max_thread_points],
+                .bucket_counts = &bucket_counts[j * num_buckets],
+                .bit_offsets = &bit_offsets[j * 32],
+                .point_schedule = thread_point_schedule,
+                .num_points = static_cast<uint32_t>(thread_end - thread_start),
+                .num_buckets = static_cast<uint32_t>(last_bucket - first_bucket + 1),
+                .bucket_empty_status = &bucket_empty_status[j * num_buckets],
+            };
+            const AffineElement* output_buckets = reduce_buckets(product_state, true, false);
+
+            // The first bucket of a slice is never empty, and the reduced buckets come out in bucket order
+            first_buckets[j] = first_bucket;
+            first_bucket_sums[j] = output_buckets[0];
+            size_t output_it = 1;
+            for (size_t k = 1; k < product_state.num_buckets; ++k) {
+                if (!product_state.bucket_empty_status[k]) {
+                    bucket_sums[first_bucket + k] = output_buckets[output_it++];
+                    bucket_is_set[first_bucket + k] = 1;
+                }
+            }
+        });
+
+        for (size_t j = 0; j < num_threads; ++j) {
+            if (round_thread_offsets[j] == round_thread_offsets[j + 1]) {
+                continue;
+            }
+            const size_t bucket = first_buckets[j];
+            if (bucket_is_set[bucket]) {
+                bucket_sums[bucket] = AffineElement(Element(bucket_sums[bucket]) + first_bucket_sums[j]);
+            } else {
+                bucket_sums[bucket] = first_bucket_sums[j];
+                bucket_is_set[bucket] = 1;
+            }
+        }
+
+        parallel_for(num_msms, [&](size_t m) {
+            const size_t msm_first_bucket = m * num_msm_buckets;
+            Element running_sum;
+            running_sum.self_set_infinity();
+            Element accumulator;
+            accumulator.self_set_infinity();
+            for (size_t k = num_msm_buckets - 1; k > 0; --k) {
+                if (bucket_is_set[msm_first_bucket + k]) {
+                    running_sum += bucket_sums[msm_first_bucket + k];
+                }
+                accumulator += running_sum;
+            }
+            if (bucket_is_set[msm_first_bucket]) {
+                running_sum += bucket_sums[msm_first_bucket];
+            }
+            accumulator.self_dbl();
+            accumulator += running_sum;
+
+            if (i > 0) {
+                for (size_t k = 0; k < wnaf_bits; ++k) {
+                    results[m].self_dbl();
+                }
+            }
+            results[m] += accumulator;
+        });
+    }
+
+    for (size_t i = 0; i < num_msms; ++i) {
+        results[i] += corrections[i];
+    }
+    return results;
+}
+
+/**
+ * Splits a run of small MSMs into consecutive groups that `pippenger_shared_buckets_unsafe` can evaluate, i.e. whose
+ * bucket count (the number of MSMs times 2^c, for the width c of the group's average MSM) stays below
+ * `BATCH_MSM_MAX_SHARED_BUCKETS`. Returns the end index of each group.
+ **/
+std::vector<size_t> get_shared_bucket_msm_groups(std::span<const size_t> msm_sizes)
+{
+    std::vector<size_t> group_ends;
+    size_t group_start = 0;
+    size_t group_num_points = 0;
+    for (size_t i = 0; i < msm_sizes.size(); ++i) {
+        const size_t num_msms = i + 1 - group_start;
+        const size_t num_points = group_num_points + msm_sizes[i];
+        // A lone MSM always fits, as the widest bucket is far below the limit
+        if (num_msms > 1 &&
+            (num_msms << get_optimal_bucket_width(num_points / num_msms)) >= BATCH_MSM_MAX_SHARED_BUCKETS) {
+            group_ends.push_back(i);
+            group_start = i;
+            group_num_points = msm_sizes[i];
+        } else {
+            group_num_points = num_points;
+        }
+    }
+    if (!msm_sizes.empty()) {
+        group_ends.push_back(msm_sizes.size());
+    }
+    return group_ends;
+}
+
+/**
+ * Evaluates several multi-scalar multiplications that share the same (pippenger point table formatted) base points,
+ * e.g. a batch of polynomial commitments against the same SRS. The `i`-th MSM uses the first `scalars[i].size()`
+ * points.
+ *
+ * Compared to calling `pippenger_unsafe` once per scalar vector:
+ * 1: large MSMs run one at a time on a single state borrowed from `runtime_states`, sized for the largest of them.
+ *    Each is already internally multi-threaded, and its rounds hold enough additions to amortise the batch
+ *    inversions, so sharing buckets with the other MSMs would only cost memory.
+ * 2: small MSMs, whose rounds are too short to keep every thread busy (or to amortise the batch inversions of the
+ *    affine additions), are evaluated together as one Pippenger instance (see `pippenger_shared_buckets_unsafe`), or
+ *    as a few of them if their buckets would not fit in one (see `get_shared_bucket_msm_groups`).
+ * 3: the Jacobian results are normalized with a single batch inversion, instead of one field inversion per
+ *    commitment.
+ * 4: each MSM skips its zero and one scalars (see `pippenger_sparse_unsafe`).
+ *
+ * Like `pippenger_unsafe`, this must not be used in a verifier.
+ **/
+template <typename Curve>
+std::vector<typename Curve::AffineElement> pippenger_batch_unsafe(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars,
+    typename Curve::AffineElement* points,
+    pippenger_runtime_state_pool<Curve>& runtime_states)
+{
+    using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    const size_t num_msms = scalars.size();
+    std::vector<Element> results(num_msms);
+
+    std::vector<size_t> small_msms;
+    std::vector<size_t> large_msms;
+    size_t max_large_msm_size = 0;
+    for (size_t i = 0; i < num_msms; ++i) {
+        if (scalars[i].empty()) {
+            results[i].self_set_infinity();
+        } else if (scalars[i].size() < BATCH_MSM_CONCURRENCY_THRESHOLD) {
+            small_msms.push_back(i);
+        } else {
+            large_msms.push_back(i);
+            max_large_msm_size = std::max(max_large_msm_size, scalars[i].size());
+        }
+    }
+
+    std::vector<size_t> small_msm_sizes;
+    std::vector<std::span<const Fr>> small_msm_scalars;
+    for (const size_t i : small_msms) {
+        small_msm_sizes.push_back(scalars[i].size());
+        small_msm_scalars.push_back(scalars[i]);
+    }
+    size_t group_start = 0;
+    for (const size_t group_end : get_shared_bucket_msm_groups(small_msm_sizes)) {
+        auto group_results = pippenger_shared_buckets_unsafe<Curve>(
+            std::span(small_msm_scalars).subspan(group_start, group_end - group_start), points);
+        for (size_t j = group_start; j < group_end; ++j) {
+            results[small_msms[j]] = group_results[j - group_start];
+        }
+        group_start = group_end;
+    }
+
+    if (!large_msms.empty()) {
+        auto state = runtime_states.acquire(max_large_msm_size);
+        for (const size_t i : large_msms) {
+            results[i] =
+                pippenger_sparse_unsafe<Curve>(const_cast<Fr*>(scalars[i].data()), points, scalars[i].size(), *state);
+        }
+    }
+
+    // One inversion for the whole batch. z = 1 afterwards, so we can read off the affine coordinates directly.
+    Element::batch_normalize(results.data(), num_msms);
+    std::vector<AffineElement> commitments(num_msms);
+    for (size_t i = 0; i < num_msms; ++i) {
+        if (results[i].is_point_at_infinity()) {
+            commitments[i] = AffineElement(results[i]);
+        } else {
+            commitments[i] = AffineElement(results[i].x, results[i].y);
+        }
+    }
+    return commitments;
+}
+
+/**
+ * Picks the fastest bucket width for each power-of-two MSM size up to `max_num_points`, by timing `pippenger_unsafe`
+ * with the widths around the default one. `points` must be a pippenger point table with at least `max_num_points`
+ * points (e.g. a prover CRS).
+ *
+ * The best width depends on the host's cache sizes and core count, so the result should be persisted (see
+ * `save_bucket_width_profile`) and loaded on the machine it was measured on. The active profile is swapped out while
+ * we measure, so no other MSMs may run concurrently.
+ **/
+template <typename Curve>
+bucket_width_profile calibrate_bucket_widths(typename Curve::AffineElement* points,
+                                             const size_t max_num_points,
+                                             const size_t num_repetitions)
+{
+    using Fr = typename Curve::ScalarField;
+
+    const auto previous_profile = get_bucket_width_profile();
+    bucket_width_profile profile = previous_profile.value_or(bucket_width_profile());
+    if (max_num_points == 0) {
+        return profile;
+    }
+
+    std::vector<Fr> scalars(max_num_points);
+    for (auto& scalar : scalars) {
+        scalar = Fr::random_element();
+    }
+
+    // `pippenger` doesn't use buckets at all at or below this size
+    const size_t naive_threshold = get_num_cpus_pow2() * 8;
+    const auto min_log_num_points = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(naive_threshold))) + 1;
+    const auto max_log_num_points = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(max_num_points)));
+
+    for (size_t log_num_points = min_log_num_points; log_num_points <= max_log_num_points; ++log_num_points) {
+        const size_t num_points = 1ULL << log_num_points;
+        const size_t default_width = get_default_bucket_width(num_points);
+        const size_t min_width =
+            std::max(default_width, bucket_width_profile::MIN_BUCKET_WIDTH + BUCKET_WIDTH_CALIBRATION_SPREAD) -
+            BUCKET_WIDTH_CALIBRATION_SPREAD;
+        const size_t max_width =
+            std::min(bucket_width_profile::MAX_BUCKET_WIDTH, default_width + BUCKET_WIDTH_CALIBRATION_SPREAD);
+
+        size_t best_width = default_width;
+        auto best_time = std::chrono::steady_clock::duration::max();
+        for (size_t width = min_width; width <= max_width; ++width) {
+            bucket_width_profile candidate = profile;
+            candidate.set_bucket_width_for_log_size(log_num_points, width);
+            set_bucket_width_profile(candidate);
+
+            pippenger_runtime_state<Curve> state(num_points);
+            // warm up the caches (and the state's memory) before timing
+            pippenger_unsafe<Curve>(&scalars[0], points, num_points, state);
+            auto width_time = std::chrono::steady_clock::duration::max();
+            for (size_t i = 0; i < num_repetitions; ++i) {
+                const auto start = std::chrono::steady_clock::now();
+                pippenger_unsafe<Curve>(&scalars[0], points, num_points, state);
+                width_time = std::min(width_time, std::chrono::steady_clock::now() - start);
+            }
+            if (width_time < best_time) {
+                best_time = width_time;
+                best_width = width;
+            }
+        }
+        profile.set_bucket_width_for_log_size(log_num_points, best_width);
+    }
+
+    set_bucket_width_profile(previous_profile);
+    profile.normalize();
+    return profile;
+}
+
 // Explicit instantiation
 // BN254
 template void generate_pippenger_point_table<curve::BN254>(curve::BN254::AffineElement* points,
@@ -999,7 +1803,24 @@ template curve::BN254::Element pippenger<curve::BN254>(curve::BN254::ScalarField
 template curve::BN254::Element pippenger_unsafe<curve::BN254>(curve::BN254::ScalarField* scalars,
                                                               curve::BN254::AffineElement* points,
                                                               const size_t num_initial_points,
-                                                              pippenger_runtime_state<curve::BN254>& state);
+                                                              pippenger_runtime_state<curve::BN254>& state,
+                                                              msm_engine engine);
+
+template curve::BN254::Element pippenger_signed_digit<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                    curve::BN254::AffineElement* points,
+                                                                    const size_t num_initial_points,
+                                                                    pippenger_runtime_state<curve::BN254>& state,
+                                                                    bool handle_edge_cases);
+
+template void compute_signed_digits<curve::BN254>(uint32_t* digits,
+                                                  const curve::BN254::ScalarField* scalars,
+                                                  const size_t num_points,
+                                                  const size_t window_bits);
+
+template curve::BN254::Element evaluate_signed_digit_window<curve::BN254>(pippenger_runtime_state<curve::BN254>& state,
+                                                                          curve::BN254::AffineElement* points,
+                                                                          const size_t num_window_points,
+                                                                          bool handle_edge_cases);
 
 template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve::BN254>(
     curve::BN254::ScalarField* scalars,
@@ -1007,6 +1828,20 @@ template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve
     const size_t num_initial_points,
     pippenger_runtime_state<curve::BN254>& state);
 
+template curve::BN254::Element pippenger_sparse_unsafe<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                     curve::BN254::AffineElement* points,
+                                                                     const size_t num_initial_points,
+                                                                     pippenger_runtime_state<curve::BN254>& state);
+
+template std::vector<curve::BN254::AffineElement> pippenger_batch_unsafe<curve::BN254>(
+    std::span<const std::span<const curve::BN254::ScalarField>> scalars,
+    curve::BN254::AffineElement* points,
+    pippenger_runtime_state_pool<curve::BN254>& runtime_states);
+
+template bucket_width_profile calibrate_bucket_widths<curve::BN254>(curve::BN254::AffineElement* points,
+                                                                    const size_t max_num_points,
+                                                                    const size_t num_repetitions);
+
 // Grumpkin
 template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
                                                               curve::Grumpkin::AffineElement* table,
@@ -1050,7 +1885,26 @@ template curve::Grumpkin::Element pippenger<curve::Grumpkin>(curve::Grumpkin::Sc
 template curve::Grumpkin::Element pippenger_unsafe<curve::Grumpkin>(curve::Grumpkin::ScalarField* scalars,
                                                                     curve::Grumpkin::AffineElement* points,
                                                                     const size_t num_initial_points,
-                                                                    pippenger_runtime_state<curve::Grumpkin>& state);
+                                                                    pippenger_runtime_state<curve::Grumpkin>& state,
+                                                                    msm_engine engine);
+
+template curve::Grumpkin::Element pippenger_signed_digit<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    bool handle_edge_cases);
+
+template void compute_signed_digits<curve::Grumpkin>(uint32_t* digits,
+                                                     const curve::Grumpkin::ScalarField* scalars,
+                                                     const size_t num_points,
+                                                     const size_t window_bits);
+
+template curve::Grumpkin::Element evaluate_signed_digit_window<curve::Grumpkin>(
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_window_points,
+    bool handle_edge_cases);
 
 template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<curve::Grumpkin>(
     curve::Grumpkin::ScalarField* scalars,
@@ -1058,6 +1912,21 @@ template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<cu
     const size_t num_initial_points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template curve::Grumpkin::Element pippenger_sparse_unsafe<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
+template std::vector<curve::Grumpkin::AffineElement> pippenger_batch_unsafe<curve::Grumpkin>(
+    std::span<const std::span<const curve::Grumpkin::ScalarField>> scalars,
+    curve::Grumpkin::AffineElement* points,
+    pippenger_runtime_state_pool<curve::Grumpkin>& runtime_states);
+
+template bucket_width_profile calibrate_bucket_widths<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
+                                                                       const size_t max_num_points,
+                                                                       const size_t num_repetitions);
+
 } // namespace barretenberg::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
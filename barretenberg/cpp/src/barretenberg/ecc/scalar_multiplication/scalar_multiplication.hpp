@@ -5,10 +5,12 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 namespace barretenberg::scalar_multiplication {
 
-constexpr size_t get_num_buckets(const size_t num_points)
+inline size_t get_num_buckets(const size_t num_points)
 {
     const size_t bits_per_bucket = get_optimal_bucket_width(num_points / 2);
     return 1UL << bits_per_bucket;
@@ -99,6 +101,11 @@ void generate_pippenger_point_table(typename Curve::AffineElement* points,
 
 void organize_buckets(uint64_t* point_schedule, size_t num_points);
 
+size_t get_bucket_aligned_thread_offset(const uint64_t* point_schedule,
+                                        size_t num_entries,
+                                        size_t num_threads,
+                                        size_t thread_index);
+
 inline void count_bits(const uint32_t* bucket_counts,
                        uint32_t* bit_offsets,
                        const uint32_t num_buckets,
@@ -158,11 +165,56 @@ typename Curve::Element pippenger(typename Curve::ScalarField* scalars,
                                   pippenger_runtime_state<Curve>& state,
                                   bool handle_edge_cases = true);
 
+/**
+ * The bucket method used by `pippenger_unsafe`:
+ * endomorphism_wnaf: split each scalar with the curve endomorphism and precompute the (sorted) WNAF schedule of every
+ *                    round. See `pippenger`.
+ * signed_digit: recode the full scalars into signed-digit windows and sort one window's schedule at a time. Less
+ *               memory traffic for very large MSMs. See `pippenger_signed_digit`.
+ */
+enum class msm_engine { endomorphism_wnaf, signed_digit };
+
+// `compute_signed_digits` doesn't split its work into chunks smaller than this
+constexpr size_t SIGNED_DIGIT_MIN_POINTS_PER_THREAD = 1UL << 10;
+
+// Enough windows to hold the largest scalar plus the carry out of its top window
+template <typename Curve> constexpr size_t get_num_signed_digit_windows(const size_t window_bits)
+{
+    constexpr size_t num_scalar_bits = Curve::ScalarField::modulus.get_msb() + 1;
+    return (num_scalar_bits + window_bits) / window_bits;
+}
+
+template <typename Curve>
+void compute_signed_digits(uint32_t* digits,
+                           const typename Curve::ScalarField* scalars,
+                           size_t num_points,
+                           size_t window_bits);
+
+size_t organize_signed_digit_schedule(uint64_t* point_schedule,
+                                      const uint32_t* window_digits,
+                                      size_t num_points,
+                                      size_t num_buckets,
+                                      std::vector<uint32_t>& thread_bucket_offsets);
+
+template <typename Curve>
+typename Curve::Element evaluate_signed_digit_window(pippenger_runtime_state<Curve>& state,
+                                                     typename Curve::AffineElement* points,
+                                                     size_t num_window_points,
+                                                     bool handle_edge_cases);
+
+template <typename Curve>
+typename Curve::Element pippenger_signed_digit(typename Curve::ScalarField* scalars,
+                                               typename Curve::AffineElement* points,
+                                               size_t num_initial_points,
+                                               pippenger_runtime_state<Curve>& state,
+                                               bool handle_edge_cases = true);
+
 template <typename Curve>
 typename Curve::Element pippenger_unsafe(typename Curve::ScalarField* scalars,
                                          typename Curve::AffineElement* points,
                                          size_t num_initial_points,
-                                         pippenger_runtime_state<Curve>& state);
+                                         pippenger_runtime_state<Curve>& state,
+                                         msm_engine engine = msm_engine::endomorphism_wnaf);
 
 template <typename Curve>
 typename Curve::Element pippenger_without_endomorphism_basis_points(typename Curve::ScalarField* scalars,
@@ -170,6 +222,39 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
                                                                     size_t num_initial_points,
                                                                     pippenger_runtime_state<Curve>& state);
 
+// `pippenger_sparse_unsafe` only compacts its input if at most (DENOMINATOR - 1) / DENOMINATOR of the scalars are
+// neither zero nor one
+constexpr size_t SPARSE_MSM_DENSITY_DENOMINATOR = 8;
+constexpr size_t SPARSE_MSM_MIN_SCAN_ITERATIONS_PER_THREAD = 1UL << 12;
+
+template <typename Curve>
+typename Curve::Element pippenger_sparse_unsafe(typename Curve::ScalarField* scalars,
+                                                typename Curve::AffineElement* points,
+                                                size_t num_initial_points,
+                                                pippenger_runtime_state<Curve>& state);
+
+// MSMs smaller than this are evaluated together, as one Pippenger instance, by `pippenger_batch_unsafe`
+constexpr size_t BATCH_MSM_CONCURRENCY_THRESHOLD = 1UL << 14;
+// ...as long as their buckets fit below this limit, which keeps the shared bucket index clear of the negation flag
+// in bit 31 of a point schedule entry (`process_buckets` rounds the index up to a whole byte)
+constexpr size_t BATCH_MSM_MAX_SHARED_BUCKETS = 1UL << 24;
+
+std::vector<size_t> get_shared_bucket_msm_groups(std::span<const size_t> msm_sizes);
+
+template <typename Curve>
+std::vector<typename Curve::AffineElement> pippenger_batch_unsafe(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars,
+    typename Curve::AffineElement* points,
+    pippenger_runtime_state_pool<Curve>& runtime_states);
+
+// `calibrate_bucket_widths` tries this many widths either side of the default width for each MSM size
+constexpr size_t BUCKET_WIDTH_CALIBRATION_SPREAD = 2;
+
+template <typename Curve>
+bucket_width_profile calibrate_bucket_widths(typename Curve::AffineElement* points,
+                                             size_t max_num_points,
+                                             size_t num_repetitions = 3);
+
 // Explicit instantiation
 // BN254
 
@@ -215,7 +300,25 @@ extern template curve::BN254::Element pippenger<curve::BN254>(curve::BN254::Scal
 extern template curve::BN254::Element pippenger_unsafe<curve::BN254>(curve::BN254::ScalarField* scalars,
                                                                      curve::BN254::AffineElement* points,
                                                                      const size_t num_initial_points,
-                                                                     pippenger_runtime_state<curve::BN254>& state);
+                                                                     pippenger_runtime_state<curve::BN254>& state,
+                                                                     msm_engine engine);
+
+extern template curve::BN254::Element pippenger_signed_digit<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                           curve::BN254::AffineElement* points,
+                                                                           const size_t num_initial_points,
+                                                                           pippenger_runtime_state<curve::BN254>& state,
+                                                                           bool handle_edge_cases);
+
+extern template void compute_signed_digits<curve::BN254>(uint32_t* digits,
+                                                         const curve::BN254::ScalarField* scalars,
+                                                         const size_t num_points,
+                                                         const size_t window_bits);
+
+extern template curve::BN254::Element evaluate_signed_digit_window<curve::BN254>(
+    pippenger_runtime_state<curve::BN254>& state,
+    curve::BN254::AffineElement* points,
+    const size_t num_window_points,
+    bool handle_edge_cases);
 
 extern template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve::BN254>(
     curve::BN254::ScalarField* scalars,
@@ -223,6 +326,21 @@ extern template curve::BN254::Element pippenger_without_endomorphism_basis_point
     const size_t num_initial_points,
     pippenger_runtime_state<curve::BN254>& state);
 
+extern template curve::BN254::Element pippenger_sparse_unsafe<curve::BN254>(
+    curve::BN254::ScalarField* scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state);
+
+extern template std::vector<curve::BN254::AffineElement> pippenger_batch_unsafe<curve::BN254>(
+    std::span<const std::span<const curve::BN254::ScalarField>> scalars,
+    curve::BN254::AffineElement* points,
+    pippenger_runtime_state_pool<curve::BN254>& runtime_states);
+
+extern template bucket_width_profile calibrate_bucket_widths<curve::BN254>(curve::BN254::AffineElement* points,
+                                                                           size_t max_num_points,
+                                                                           size_t num_repetitions);
+
 // Grumpkin
 
 extern template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
@@ -269,7 +387,26 @@ extern template curve::Grumpkin::Element pippenger_unsafe<curve::Grumpkin>(
     curve::Grumpkin::ScalarField* scalars,
     curve::Grumpkin::AffineElement* points,
     const size_t num_initial_points,
-    pippenger_runtime_state<curve::Grumpkin>& state);
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    msm_engine engine);
+
+extern template curve::Grumpkin::Element pippenger_signed_digit<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    bool handle_edge_cases);
+
+extern template void compute_signed_digits<curve::Grumpkin>(uint32_t* digits,
+                                                            const curve::Grumpkin::ScalarField* scalars,
+                                                            const size_t num_points,
+                                                            const size_t window_bits);
+
+extern template curve::Grumpkin::Element evaluate_signed_digit_window<curve::Grumpkin>(
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_window_points,
+    bool handle_edge_cases);
 
 extern template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<curve::Grumpkin>(
     curve::Grumpkin::ScalarField* scalars,
@@ -277,4 +414,19 @@ extern template curve::Grumpkin::Element pippenger_without_endomorphism_basis_po
     const size_t num_initial_points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+extern template curve::Grumpkin::Element pippenger_sparse_unsafe<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
+extern template std::vector<curve::Grumpkin::AffineElement> pippenger_batch_unsafe<curve::Grumpkin>(
+    std::span<const std::span<const curve::Grumpkin::ScalarField>> scalars,
+    curve::Grumpkin::AffineElement* points,
+    pippenger_runtime_state_pool<curve::Grumpkin>& runtime_states);
+
+extern template bucket_width_profile calibrate_bucket_widths<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
+                                                                              size_t max_num_points,
+                                                                              size_t num_repetitions);
+
 } // namespace barretenberg::scalar_multiplication
@@ -19,7 +19,9 @@
 
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
+#include <vector>
 
 namespace proof_system::honk::pcs {
 
@@ -47,19 +49,21 @@ template <class Curve> class CommitmentKey {
      *
      */
     CommitmentKey(const size_t num_points, std::shared_ptr<barretenberg::srs::factories::CrsFactory<Curve>> crs_factory)
-        : pippenger_runtime_state(num_points)
-        , srs(crs_factory->get_prover_crs(num_points))
+        : srs(crs_factory->get_prover_crs(num_points))
     {}
 
     // Note: This constructor is used only by Plonk; For Honk the srs is extracted by the CommitmentKey
-    CommitmentKey(const size_t num_points, std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> prover_crs)
-        : pippenger_runtime_state(num_points)
-        , srs(prover_crs)
+    CommitmentKey([[maybe_unused]] const size_t num_points,
+                  std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> prover_crs)
+        : srs(prover_crs)
     {}
 
     /**
      * @brief Uses the ProverSRS to create a commitment to p(X)
      *
+     * @details Zero coefficients are skipped and coefficients equal to one are handled with plain point additions,
+     * so committing to sparse polynomials (e.g. selectors) only costs an MSM over their non-trivial coefficients.
+     *
      * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
      * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
      */
@@ -67,11 +71,37 @@ template <class Curve> class CommitmentKey {
     {
         const size_t degree = polynomial.size();
         ASSERT(degree <= srs->get_monomial_size());
-        return barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
-            const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
+        auto pippenger_runtime_state = get_pippenger_runtime_state(degree);
+        return barretenberg::scalar_multiplication::pippenger_sparse_unsafe<Curve>(
+            const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, *pippenger_runtime_state);
     };
 
-    barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
+    /**
+     * @brief Commit to a batch of polynomials at once
+     * @details Cheaper than calling commit() on each polynomial: small MSMs are evaluated concurrently, scratch space
+     * is shared across the batch and all commitments are converted to affine form with a single batch inversion.
+     *
+     * @param polynomials univariate polynomials pⱼ(X), each of size at most the size of the srs
+     * @return Commitments Cⱼ = [pⱼ(x)], in the same order as the input
+     */
+    std::vector<Commitment> batch_commit(std::span<const std::span<const Fr>> polynomials)
+    {
+        for (const auto& polynomial : polynomials) {
+            ASSERT(polynomial.size() <= srs->get_monomial_size());
+        }
+        return barretenberg::scalar_multiplication::pippenger_batch_unsafe<Curve>(
+            polynomials, srs->get_monomial_points(), srs->pippenger_runtime_states);
+    }
+
+    /**
+     * @brief Borrow scratch space for an MSM of up to `num_points` points from the pool owned by the srs. It is
+     * returned to the pool when the handle goes out of scope.
+     */
+    auto get_pippenger_runtime_state(const size_t num_points)
+    {
+        return srs->pippenger_runtime_states.acquire(num_points);
+    }
+
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> srs;
 };
 
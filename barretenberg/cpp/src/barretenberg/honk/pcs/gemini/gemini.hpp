@@ -154,7 +154,7 @@ template <typename Curve> class GeminiVerifier_ {
         std::vector<Fr> evaluations;
         evaluations.reserve(num_variables);
         for (size_t i = 0; i < num_variables; ++i) {
-            auto eval = transcript.template receive_from_prover<Fr>("Gemini:a_" + std::to_string(i));
+            auto eval = transcript.template receive_from_prover<Fr>("Gemini:a_", i);
             evaluations.emplace_back(eval);
         }
 
@@ -27,7 +27,7 @@ template <typename Curve> class IPA {
     /**
      * @brief Compute an inner product argument proof for opening a single polynomial at a single evaluation point
      *
-     * @param ck The commitment key containing srs and pippenger_runtime_state for computing MSM
+     * @param ck The commitment key containing srs and the pool of pippenger runtime states for computing MSM
      * @param opening_pair (challenge, evaluation)
      * @param polynomial The witness polynomial whose opening proof needs to be computed
      * @param transcript Prover transcript
@@ -68,6 +68,8 @@ template <typename Curve> class IPA {
         std::vector<GroupElement> L_elements(log_poly_degree);
         std::vector<GroupElement> R_elements(log_poly_degree);
         std::size_t round_size = poly_degree;
+        // Every round's MSMs are at most half the size of the polynomial
+        auto pippenger_runtime_state = ck->get_pippenger_runtime_state(poly_degree >> 1);
 
         // TODO(#479): restructure IPA so it can be integrated with the pthread alternative to work queue (or even the
         // work queue itself). Investigate whether parallelising parts of each rounds of IPA rounds brings significant
@@ -86,13 +88,13 @@ template <typename Curve> class IPA {
             L_elements[i] =
                 // TODO(#473)
                 barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                    &a_vec[0], &G_vec_local[round_size], round_size, ck->pippenger_runtime_state);
+                    &a_vec[0], &G_vec_local[round_size], round_size, *pippenger_runtime_state);
             L_elements[i] += aux_generator * inner_prod_L;
 
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
             // TODO(#473)
             R_elements[i] = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[round_size], &G_vec_local[0], round_size, ck->pippenger_runtime_state);
+                &a_vec[round_size], &G_vec_local[0], round_size, *pippenger_runtime_state);
             R_elements[i] += aux_generator * inner_prod_R;
 
             std::string index = std::to_string(i);
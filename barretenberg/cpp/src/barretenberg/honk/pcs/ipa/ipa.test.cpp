@@ -69,6 +69,9 @@ TEST_F(IPATest, Open)
     const OpeningPair<Curve> opening_pair = { x, eval };
     const OpeningClaim<Curve> opening_claim{ opening_pair, commitment };
 
+    // record manifests so that prover and verifier can be compared below
+    TranscriptManifest::ScopedRecording record_manifests;
+
     // initialize empty prover transcript
     ProverTranscript<Fr> prover_transcript;
     IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcript);
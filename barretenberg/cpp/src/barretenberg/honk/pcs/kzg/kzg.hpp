@@ -22,7 +22,7 @@ template <typename Curve> class KZG {
     /**
      * @brief Computes the KZG commitment to an opening proof polynomial at a single evaluation point
      *
-     * @param ck The commitment key which has a commit function, the srs and pippenger_runtime_state
+     * @param ck The commitment key which has a commit function, the srs and a pool of pippenger runtime states
      * @param opening_pair OpeningPair = {r, v = p(r)}
      * @param polynomial The witness whose opening proof needs to be computed
      * @param prover_transcript Prover transcript
@@ -49,6 +49,28 @@ TYPED_TEST(KZGTest, single)
     EXPECT_EQ(verified, true);
 }
 
+TYPED_TEST(KZGTest, BatchCommit)
+{
+    using Fr = typename TypeParam::ScalarField;
+    using Polynomial = barretenberg::Polynomial<Fr>;
+
+    std::vector<Polynomial> polynomials;
+    for (const size_t n : { 1UL, 16UL, 1024UL, 17UL }) {
+        polynomials.emplace_back(this->random_polynomial(n));
+    }
+    std::vector<std::span<const Fr>> polynomial_spans;
+    for (const auto& polynomial : polynomials) {
+        polynomial_spans.emplace_back(polynomial);
+    }
+
+    auto commitments = this->ck()->batch_commit(polynomial_spans);
+
+    ASSERT_EQ(commitments.size(), polynomials.size());
+    for (size_t i = 0; i < polynomials.size(); ++i) {
+        EXPECT_EQ(commitments[i], this->commit(polynomials[i]));
+    }
+}
+
 /**
  * @brief Test full PCS protocol: Gemini, Shplonk, KZG and pairing check
  * @details Demonstrates the full PCS protocol as it is used in the construction and verification
@@ -76,7 +76,8 @@ template <class Curve> class ZeroMorphTest : public CommitmentTest<Curve> {
             g_commitments.emplace_back(f_commitments[i]);
         }
 
-        // Initialize an empty ProverTranscript
+        // Initialize an empty ProverTranscript, recording a manifest to compare against the verifier's
+        TranscriptManifest::ScopedRecording record_manifests;
         auto prover_transcript = ProverTranscript<Fr>::init_empty();
 
         // Execute Prover protocol
@@ -37,10 +37,10 @@ namespace proof_system::honk::permutation_library {
  *                B(h)
  *
  * Step 1) Compute 2 length-n polynomials A, B
- * Step 2) Compute 2 length-n polynomials numerator = ∏ A(j), nenominator = ∏ B(j)
- * Step 3) Compute Z_perm[i + 1] = numerator[i] / denominator[i] (recall: Z_perm[0] = 1)
+ * Step 2) Compute the length-n polynomial numerator[i] = ∏ A(j) / B(j), where ∏ := ∏_{j=0:i}
+ * Step 3) Set Z_perm[i + 1] = numerator[i] (recall: Z_perm[0] = 1)
  *
- * Note: Step (3) utilizes Montgomery batch inversion to replace n-many inversions with
+ * Note: Step (2) utilizes Montgomery batch inversion to replace n-many inversions with one per thread
  */
 template <typename Flavor, typename PermutationRelation>
 void compute_permutation_grand_product(const size_t circuit_size,
@@ -81,60 +81,19 @@ void compute_permutation_grand_product(const size_t circuit_size,
     });
 
     // Step (2)
-    // Compute the accumulating product of the numerator and denominator terms.
-    // This step is split into three parts for efficient multithreading:
-    // (i) compute ∏ A(j), ∏ B(j) subproducts for each thread
-    // (ii) compute scaling factor required to convert each subproduct into a single running product
-    // (ii) combine subproducts into a single running product
-    //
-    // For example, consider 4 threads and a size-8 numerator { a0, a1, a2, a3, a4, a5, a6, a7 }
-    // (i)   Each thread computes 1 element of N = {{ a0, a0a1 }, { a2, a2a3 }, { a4, a4a5 }, { a6, a6a7 }}
-    // (ii)  Take partial products P = { 1, a0a1, a2a3, a4a5 }
-    // (iii) Each thread j computes N[i][j]*P[j]=
-    //      {{a0,a0a1},{a0a1a2,a0a1a2a3},{a0a1a2a3a4,a0a1a2a3a4a5},{a0a1a2a3a4a5a6,a0a1a2a3a4a5a6a7}}
-    std::vector<FF> partial_numerators(num_threads);
-    std::vector<FF> partial_denominators(num_threads);
+    // Replace numerator[i] with ∏_{j ≤ i} A(j) / B(j). The running products of the numerator and denominator terms
+    // and the batch inversion of the denominators are done together, in one parallel scan.
+    barretenberg::polynomial_arithmetic::compute_prefix_quotients(std::span<FF>{ numerator },
+                                                                  std::span<const FF>{ denominator });
 
-    parallel_for(num_threads, [&](size_t thread_idx) {
-        const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
-        for (size_t i = start; i < end - 1; ++i) {
-            numerator[i + 1] *= numerator[i];
-            denominator[i + 1] *= denominator[i];
-        }
-        partial_numerators[thread_idx] = numerator[end - 1];
-        partial_denominators[thread_idx] = denominator[end - 1];
-    });
-
-    parallel_for(num_threads, [&](size_t thread_idx) {
-        const size_t start = thread_idx * block_size;
-        const size_t end = (thread_idx + 1) * block_size;
-        if (thread_idx > 0) {
-            FF numerator_scaling = 1;
-            FF denominator_scaling = 1;
-
-            for (size_t j = 0; j < thread_idx; ++j) {
-                numerator_scaling *= partial_numerators[j];
-                denominator_scaling *= partial_denominators[j];
-            }
-            for (size_t i = start; i < end; ++i) {
-                numerator[i] *= numerator_scaling;
-                denominator[i] *= denominator_scaling;
-            }
-        }
-
-        // Final step: invert denominator
-        FF::batch_invert(std::span{ &denominator[start], block_size });
-    });
-
-    // Step (3) Compute z_perm[i] = numerator[i] / denominator[i]
+    // Step (3) Shift the quotients into place: z_perm[i + 1] = numerator[i]
     auto& grand_product_polynomial = PermutationRelation::get_grand_product_polynomial(full_polynomials);
     grand_product_polynomial[0] = 0;
     parallel_for(num_threads, [&](size_t thread_idx) {
         const size_t start = thread_idx * block_size;
         const size_t end = (thread_idx == num_threads - 1) ? circuit_size - 1 : (thread_idx + 1) * block_size;
         for (size_t i = start; i < end; ++i) {
-            grand_product_polynomial[i + 1] = numerator[i] * denominator[i];
+            grand_product_polynomial[i + 1] = numerator[i];
         }
     });
 }
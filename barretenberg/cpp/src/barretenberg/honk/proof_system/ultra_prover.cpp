@@ -39,7 +39,7 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_preamble_round(
 
     for (size_t i = 0; i < proving_key->num_public_inputs; ++i) {
         auto public_input_i = instance->public_inputs[i];
-        transcript.send_to_verifier("public_input_" + std::to_string(i), public_input_i);
+        transcript.send_to_verifier("public_input_", i, public_input_i);
     }
 }
 
@@ -160,9 +160,8 @@ template <UltraFlavor Flavor> void UltraProver_<Flavor>::execute_pcs_evaluation_
         sumcheck_output.challenge, std::move(gemini_polynomials), r_challenge);
 
     for (size_t l = 0; l < instance->proving_key->log_circuit_size; ++l) {
-        std::string label = "Gemini:a_" + std::to_string(l);
         const auto& evaluation = univariate_openings.opening_pairs[l + 1].evaluation;
-        transcript.send_to_verifier(label, evaluation);
+        transcript.send_to_verifier("Gemini:a_", l, evaluation);
     }
 }
 
@@ -66,7 +66,7 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const plonk
 
     std::vector<FF> public_inputs;
     for (size_t i = 0; i < public_input_size; ++i) {
-        auto public_input_i = transcript.template receive_from_prover<FF>("public_input_" + std::to_string(i));
+        auto public_input_i = transcript.template receive_from_prover<FF>("public_input_", i);
         public_inputs.emplace_back(public_input_i);
     }
 
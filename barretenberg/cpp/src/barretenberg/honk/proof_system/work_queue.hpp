@@ -4,6 +4,8 @@
 #include "barretenberg/srs/global_crs.hpp"
 #include <cstddef>
 #include <memory>
+#include <span>
+#include <vector>
 
 namespace proof_system::honk {
 
@@ -102,22 +104,29 @@ template <typename Curve> class work_queue {
 
     void process_queue()
     {
+        // All queued scalar multiplications are over the same srs, so run them as a single batch.
+        std::vector<std::span<const FF>> msm_scalars;
+        std::vector<const work_item*> msm_items;
         for (const auto& item : work_item_queue) {
             switch (item.work_type) {
 
             case WorkType::SCALAR_MULTIPLICATION: {
-
-                // Run pippenger multi-scalar multiplication.
-                auto commitment = commitment_key->commit(item.mul_scalars);
-
-                transcript.send_to_verifier(item.label, commitment);
-
+                msm_scalars.emplace_back(item.mul_scalars);
+                msm_items.emplace_back(&item);
                 break;
             }
             default: {
             }
             }
         }
+
+        if (!msm_items.empty()) {
+            // Run pippenger multi-scalar multiplications.
+            auto commitments = commitment_key->batch_commit(msm_scalars);
+            for (size_t i = 0; i < msm_items.size(); ++i) {
+                transcript.send_to_verifier(msm_items[i]->label, commitments[i]);
+            }
+        }
         work_item_queue = std::vector<work_item>();
     };
 
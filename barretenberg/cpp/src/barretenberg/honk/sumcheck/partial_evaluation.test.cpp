@@ -312,4 +312,54 @@ TYPED_TEST(PartialEvaluationTests, ThreeRoundsGenericMultiplePolys)
     }
 }
 
+/*
+ * Fold polynomials large enough to be split over several blocks and threads, including the in-place rounds where
+ * blocks must be ordered so that no entry is overwritten before it has been read.
+ */
+TYPED_TEST(PartialEvaluationTests, ManyRoundsLargePolys)
+{
+    using Flavor = TypeParam;
+    using FF = typename Flavor::FF;
+    using Transcript = proof_system::honk::ProverTranscript<FF>;
+
+    const size_t multivariate_d(14);
+    const size_t multivariate_n(1 << multivariate_d);
+    constexpr size_t num_polys = 3;
+
+    std::array<std::vector<FF>, num_polys> polys;
+    for (auto& poly : polys) {
+        poly.resize(multivariate_n);
+        poly[0] = FF::random_element();
+        for (size_t i = 1; i < multivariate_n; ++i) {
+            poly[i] = poly[i - 1].sqr() + FF(i);
+        }
+    }
+    auto full_polynomials = std::array<std::span<FF>, num_polys>{ polys[0], polys[1], polys[2] };
+    auto transcript = Transcript::init_empty();
+    auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+
+    // Fold a copy of each polynomial out of place as the reference
+    auto expected = polys;
+    for (size_t round_size = multivariate_n; round_size > 1; round_size >>= 1) {
+        FF round_challenge = FF::random_element();
+        for (auto& poly : expected) {
+            std::vector<FF> folded(round_size >> 1);
+            for (size_t i = 0; i < (round_size >> 1); ++i) {
+                folded[i] = poly[2 * i] + round_challenge * (poly[2 * i + 1] - poly[2 * i]);
+            }
+            poly = folded;
+        }
+        if (round_size == multivariate_n) {
+            sumcheck.partially_evaluate(full_polynomials, round_size, round_challenge);
+        } else {
+            sumcheck.partially_evaluate(sumcheck.partially_evaluated_polynomials, round_size, round_challenge);
+        }
+        for (size_t j = 0; j < num_polys; ++j) {
+            for (size_t i = 0; i < (round_size >> 1); ++i) {
+                EXPECT_EQ(sumcheck.partially_evaluated_polynomials[j][i], expected[j][i]);
+            }
+        }
+    }
+}
+
 } // namespace test_sumcheck_polynomials
@@ -1,5 +1,6 @@
 #pragma once
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/honk/sumcheck/sumcheck_output.hpp"
 #include "barretenberg/honk/transcript/transcript.hpp"
@@ -55,6 +56,10 @@ template <typename Flavor> class SumcheckProver {
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
 
+    // partially_evaluate folds this many edges of every polynomial at a time
+    static constexpr size_t EDGES_PER_FOLD_BLOCK = 1 << 8;
+    static constexpr size_t MIN_EDGES_PER_FOLD_THREAD = 1 << 10;
+
     // prover instantiates sumcheck with circuit size and a prover transcript
     SumcheckProver(size_t multivariate_n, ProverTranscript<FF>& transcript)
         : transcript(transcript)
@@ -76,6 +81,7 @@ template <typename Flavor> class SumcheckProver {
         auto [alpha, zeta] = transcript.get_challenges("Sumcheck:alpha", "Sumcheck:zeta");
 
         barretenberg::PowUnivariate<FF> pow_univariate(zeta);
+        pow_univariate.compute_pow_table(multivariate_n >> 1);
 
         std::vector<FF> multivariate_challenge;
         multivariate_challenge.reserve(multivariate_d);
@@ -97,8 +103,8 @@ template <typename Flavor> class SumcheckProver {
             // Write the round univariate to the transcript
             round_univariate =
                 round.compute_univariate(partially_evaluated_polynomials, relation_parameters, pow_univariate, alpha);
-            transcript.send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
-            FF round_challenge = transcript.get_challenge("Sumcheck:u_" + std::to_string(round_idx));
+            transcript.send_to_verifier("Sumcheck:univariate_", round_idx, round_univariate);
+            FF round_challenge = transcript.get_challenge("Sumcheck:u_", round_idx);
             multivariate_challenge.emplace_back(round_challenge);
             partially_evaluate(partially_evaluated_polynomials, round.round_size, round_challenge);
             pow_univariate.partially_evaluate(round_challenge);
@@ -136,12 +142,35 @@ template <typename Flavor> class SumcheckProver {
      */
     void partially_evaluate(auto& polynomials, size_t round_size, FF round_challenge)
     {
-        // after the first round, operate in place on partially_evaluated_polynomials
-        for (size_t j = 0; j < polynomials.size(); ++j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                partially_evaluated_polynomials[j][i >> 1] =
-                    polynomials[j][i] + round_challenge * (polynomials[j][i + 1] - polynomials[j][i]);
+        // Fold one block of edges in every polynomial before moving on to the next block, so each thread sweeps
+        // through all of the polynomials together rather than making a separate pass over each one
+        auto fold_edges = [&](size_t start, size_t end) {
+            for (size_t block_start = start; block_start < end; block_start += EDGES_PER_FOLD_BLOCK) {
+                const size_t block_end = std::min(block_start + EDGES_PER_FOLD_BLOCK, end);
+                for (size_t j = 0; j < polynomials.size(); ++j) {
+                    for (size_t i = block_start; i < block_end; ++i) {
+                        partially_evaluated_polynomials[j][i] =
+                            polynomials[j][i << 1] +
+                            round_challenge * (polynomials[j][(i << 1) + 1] - polynomials[j][i << 1]);
+                    }
+                }
             }
+        };
+
+        const size_t num_edges = round_size >> 1;
+        // The first round reads the full polynomials and writes the half-size buffers, so edges can be folded in any
+        // order
+        if (static_cast<const void*>(&polynomials) != static_cast<const void*>(&partially_evaluated_polynomials)) {
+            parallel_for_range(0, num_edges, MIN_EDGES_PER_FOLD_THREAD, fold_edges);
+            return;
+        }
+        // After the first round we fold in place: edge i writes entry i and reads entries 2i and 2i + 1. The edges in
+        // [a, 2a) write to [a, 2a) and read from [2a, 4a), so they can be folded in parallel once the edges below a
+        // have read [a, 2a). Folding the first block serially and then doubling a gives that ordering.
+        const size_t first_block_end = std::min(EDGES_PER_FOLD_BLOCK, num_edges);
+        fold_edges(0, first_block_end);
+        for (size_t start = first_block_end; start < num_edges; start <<= 1) {
+            parallel_for_range(start, std::min(start << 1, num_edges), MIN_EDGES_PER_FOLD_THREAD, fold_edges);
         }
     };
 };
@@ -191,14 +220,13 @@ template <typename Flavor> class SumcheckVerifier {
 
         for (size_t round_idx = 0; round_idx < multivariate_d; round_idx++) {
             // Obtain the round univariate from the transcript
-            std::string round_univariate_label = "Sumcheck:univariate_" + std::to_string(round_idx);
             auto round_univariate =
                 transcript.template receive_from_prover<barretenberg::Univariate<FF, MAX_RANDOM_RELATION_LENGTH>>(
-                    round_univariate_label);
+                    "Sumcheck:univariate_", round_idx);
 
             bool checked = round.check_sum(round_univariate);
             verified = verified && checked;
-            FF round_challenge = transcript.get_challenge("Sumcheck:u_" + std::to_string(round_idx));
+            FF round_challenge = transcript.get_challenge("Sumcheck:u_", round_idx);
             multivariate_challenge.emplace_back(round_challenge);
 
             round.compute_next_target_sum(round_univariate, round_challenge);
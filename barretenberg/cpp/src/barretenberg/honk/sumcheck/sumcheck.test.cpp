@@ -190,6 +190,45 @@ TEST_F(SumcheckTests, Prover)
     }
 }
 
+/**
+ * @brief Check that skipping relations on edges where their gating selector vanishes does not change the round
+ * univariate, with the selectors zeroed over blocks of rows as in a typical circuit
+ */
+TEST_F(SumcheckTests, SkipInactiveRelations)
+{
+    const size_t multivariate_d(9);
+    const size_t multivariate_n(1 << multivariate_d);
+
+    std::array<barretenberg::Polynomial<FF>, NUM_POLYNOMIALS> random_polynomials;
+    for (auto& poly : random_polynomials) {
+        poly = random_poly(multivariate_n);
+    }
+    auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+    // Each selector is live on a different block; the odd bounds leave edges with exactly one nonzero endpoint
+    auto zero_outside = [&](auto& selector, size_t start, size_t end) {
+        for (size_t i = 0; i < multivariate_n; ++i) {
+            if (i < start || i >= end) {
+                selector[i] = 0;
+            }
+        }
+    };
+    zero_outside(full_polynomials.q_arith, 0, 301);
+    zero_outside(full_polynomials.q_sort, 301, 320);
+    zero_outside(full_polynomials.q_elliptic, 320, 333);
+    zero_outside(full_polynomials.q_aux, 333, multivariate_n);
+
+    auto relation_parameters = proof_system::RelationParameters<FF>::get_random();
+    barretenberg::PowUnivariate<FF> pow_univariate(FF::random_element());
+    const FF alpha = FF::random_element();
+
+    SumcheckProverRound<Flavor> skipping_round(multivariate_n);
+    SumcheckProverRound<Flavor> reference_round(multivariate_n);
+    reference_round.skip_inactive_relations = false;
+    auto univariate = skipping_round.compute_univariate(full_polynomials, relation_parameters, pow_univariate, alpha);
+    auto expected = reference_round.compute_univariate(full_polynomials, relation_parameters, pow_univariate, alpha);
+    EXPECT_EQ(univariate, expected);
+}
+
 // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
 TEST_F(SumcheckTests, ProverAndVerifierSimple)
 {
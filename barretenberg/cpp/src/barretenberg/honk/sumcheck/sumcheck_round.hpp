@@ -1,7 +1,6 @@
 #pragma once
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/thread.hpp"
-#include "barretenberg/common/thread_utils.hpp"
 #include "barretenberg/polynomials/barycentric.hpp"
 #include "barretenberg/polynomials/pow.hpp"
 #include "barretenberg/proof_system/flavor/flavor.hpp"
@@ -70,6 +69,14 @@ template <typename Flavor> class SumcheckProverRound {
 
     RelationUnivariates univariate_accumulators;
 
+    // Relations whose gating selector vanishes on an edge are not evaluated there, since their contribution would be
+    // zero. Turning this off evaluates every relation on every edge, which is only useful as a reference
+    bool skip_inactive_relations = true;
+
+    // Number of edges a thread claims at a time in compute_univariate
+    static constexpr size_t EDGES_PER_CHUNK = 1 << 5;
+    using RelationMask = std::array<bool, NUM_RELATIONS>;
+
     // TODO(#224)(Cody): this should go away
     barretenberg::BarycentricData<FF, 2, MAX_RELATION_LENGTH> barycentric_2_to_max;
 
@@ -129,60 +136,52 @@ template <typename Flavor> class SumcheckProverRound {
         const barretenberg::PowUnivariate<FF>& pow_univariate,
         const FF alpha)
     {
-        // Precompute the vector of required powers of zeta
-        // TODO(luke): Parallelize this
-        std::vector<FF> pow_challenges(round_size >> 1);
-        pow_challenges[0] = pow_univariate.partial_evaluation_constant;
-        for (size_t i = 1; i < (round_size >> 1); ++i) {
-            pow_challenges[i] = pow_challenges[i - 1] * pow_univariate.zeta_pow_sqr;
+        // The prover builds the table of zeta powers once, before the first round. Callers that drive a lone round
+        // get a table for just that round
+        if (pow_univariate.pow_table.empty()) {
+            auto pow_univariate_with_table = pow_univariate;
+            pow_univariate_with_table.compute_pow_table(round_size >> 1);
+            return compute_univariate(polynomials, relation_parameters, pow_univariate_with_table, alpha);
         }
 
-        // Determine number of threads for multithreading.
-        // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
-        // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
-        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads =
-            barretenberg::thread_utils::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
-
-        // Constuct univariate accumulator containers; one per thread
-        std::vector<RelationUnivariates> thread_univariate_accumulators(num_threads);
-        for (auto& accum : thread_univariate_accumulators) {
-            zero_univariates(accum);
-        }
+        // Edges are handed out in small chunks that threads claim as they go, rather than in one even slice per
+        // thread, since skipping inactive relations makes the cost of an edge depend on which gates it spans.
+        RelationUnivariates zero_accumulators;
+        zero_univariates(zero_accumulators);
+
+        // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube. Each thread gets its
+        // own univariate accumulators, which are summed once all chunks are complete.
+        auto accumulated = parallel_reduce_dynamic(
+            0,
+            round_size >> 1,
+            EDGES_PER_CHUNK,
+            zero_accumulators,
+            [&](RelationUnivariates& thread_accumulators, size_t start, size_t end) {
+                ExtendedEdges<MAX_RELATION_LENGTH> extended_edges;
+
+                // For each edge_idx = 2i, we need to multiply the whole contribution by zeta^{2^{2i}}
+                // This means that each univariate for each relation needs an extra multiplication.
+                for (size_t i = start; i < end; ++i) {
+                    size_t edge_idx = i << 1;
+                    const RelationMask active_relations = get_active_relations(polynomials, edge_idx);
+                    extend_edges(extended_edges, polynomials, edge_idx);
+
+                    // Update the pow polynomial's contribution c_l ⋅ ζ_{l+1}ⁱ for the next edge.
+                    FF pow_challenge = pow_univariate.get_pow_challenge(i);
+
+                    // Compute the i-th edge's univariate contribution,
+                    // scale it by the pow polynomial's constant and zeta power "c_l ⋅ ζ_{l+1}ⁱ"
+                    // and add it to the accumulators for Sˡ(Xₗ)
+                    accumulate_relation_univariates<>(
+                        thread_accumulators, extended_edges, relation_parameters, pow_challenge, active_relations);
+                }
+            },
+            [](RelationUnivariates accumulators, const RelationUnivariates& thread_accumulators) {
+                add_nested_tuples(accumulators, thread_accumulators);
+                return accumulators;
+            });
+        add_nested_tuples(univariate_accumulators, accumulated);
 
-        // Constuct extended edge containers; one per thread
-        std::vector<ExtendedEdges<MAX_RELATION_LENGTH>> extended_edges;
-        extended_edges.resize(num_threads);
-
-        // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
-        parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            // For each edge_idx = 2i, we need to multiply the whole contribution by zeta^{2^{2i}}
-            // This means that each univariate for each relation needs an extra multiplication.
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-
-                // Update the pow polynomial's contribution c_l ⋅ ζ_{l+1}ⁱ for the next edge.
-                FF pow_challenge = pow_challenges[edge_idx >> 1];
-
-                // Compute the i-th edge's univariate contribution,
-                // scale it by the pow polynomial's constant and zeta power "c_l ⋅ ζ_{l+1}ⁱ"
-                // and add it to the accumulators for Sˡ(Xₗ)
-                accumulate_relation_univariates<>(thread_univariate_accumulators[thread_idx],
-                                                  extended_edges[thread_idx],
-                                                  relation_parameters,
-                                                  pow_challenge);
-            }
-        });
-
-        // Accumulate the per-thread univariate accumulators into a single set of accumulators
-        for (auto& accumulators : thread_univariate_accumulators) {
-            add_nested_tuples(univariate_accumulators, accumulators);
-        }
         // Batch the univariate contributions from each sub-relation to obtain the round univariate
         return batch_over_relations(alpha, pow_univariate);
     }
@@ -207,16 +206,38 @@ template <typename Flavor> class SumcheckProverRound {
     void accumulate_relation_univariates(RelationUnivariates& univariate_accumulators,
                                          const auto& extended_edges,
                                          const proof_system::RelationParameters<FF>& relation_parameters,
-                                         const FF& scaling_factor)
+                                         const FF& scaling_factor,
+                                         const RelationMask& active_relations)
     {
-        std::get<relation_idx>(relations).add_edge_contribution(
-            std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        if (active_relations[relation_idx]) {
+            std::get<relation_idx>(relations).add_edge_contribution(
+                std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
+        }
 
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < NUM_RELATIONS) {
             accumulate_relation_univariates<relation_idx + 1>(
-                univariate_accumulators, extended_edges, relation_parameters, scaling_factor);
+                univariate_accumulators, extended_edges, relation_parameters, scaling_factor, active_relations);
+        }
+    }
+
+    /**
+     * @brief Determine which relations can contribute on the edge starting at `edge_idx`, before any of the edge is
+     * extended. A relation is dropped when its gating selector vanishes on the edge (see
+     * `Relation::is_inactive_on_edge`), which only costs a zero check of the two selector values.
+     */
+    RelationMask get_active_relations(const auto& polynomials, size_t edge_idx) const
+    {
+        RelationMask active_relations;
+        active_relations.fill(true);
+        if (skip_inactive_relations) {
+            [&]<size_t... relation_idx>(std::index_sequence<relation_idx...>) {
+                ((active_relations[relation_idx] =
+                      !std::tuple_element_t<relation_idx, Relations>::is_inactive_on_edge(polynomials, edge_idx)),
+                 ...);
+            }(std::make_index_sequence<NUM_RELATIONS>{});
         }
+        return active_relations;
     }
 
   public:
@@ -3,6 +3,7 @@
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/crypto/blake3s/blake3s.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
 
 #include <algorithm>
 #include <array>
@@ -12,6 +13,7 @@
 #include <map>
 #include <span>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -28,6 +30,41 @@ class TranscriptManifest {
     std::map<size_t, RoundData> manifest;
 
   public:
+    /**
+     * @brief Whether transcripts record a manifest of their interactions
+     * @details Recording costs a label string and a map insertion per element, so it is only on by default in debug
+     * builds. Tests that inspect manifests switch it on with a ScopedRecording.
+     */
+#ifdef NDEBUG
+    static inline bool enabled = false;
+#else
+    static inline bool enabled = true;
+#endif
+
+    /**
+     * @brief Switch manifest recording on for the lifetime of this object, restoring the previous setting after
+     */
+    class ScopedRecording {
+        bool was_enabled;
+
+      public:
+        ScopedRecording()
+            : was_enabled(enabled)
+        {
+            enabled = true;
+        }
+        ScopedRecording(const ScopedRecording&) = delete;
+        ScopedRecording(ScopedRecording&&) = delete;
+        ScopedRecording& operator=(const ScopedRecording&) = delete;
+        ScopedRecording& operator=(ScopedRecording&&) = delete;
+        ~ScopedRecording() { enabled = was_enabled; }
+    };
+
+    static std::string indexed_label(std::string_view label, size_t label_index)
+    {
+        return std::string(label) + std::to_string(label_index);
+    }
+
     void print()
     {
         for (auto& round : manifest) {
@@ -41,9 +78,9 @@ class TranscriptManifest {
         }
     }
 
-    template <typename... Strings> void add_challenge(size_t round, Strings&... labels)
+    template <typename... Strings> void add_challenge(size_t round, const Strings&... labels)
     {
-        manifest[round].challenge_label = { labels... };
+        manifest[round].challenge_label = { std::string(labels)... };
     }
     void add_entry(size_t round, std::string element_label, size_t element_size)
     {
@@ -70,21 +107,64 @@ template <typename FF> class BaseTranscript {
 
   private:
     static constexpr size_t MIN_BYTES_PER_CHALLENGE = 128 / 8; // 128 bit challenges
+    static constexpr size_t BYTES_PER_CHUNK = 31;              // bytes packed into each field element by the pre-hash
 
     size_t round_number = 0;        // current round for manifest
     bool is_first_challenge = true; // indicates if this is the first challenge this transcript is generating
-    std::array<uint8_t, HASH_OUTPUT_SIZE> previous_challenge_buffer{}; // default-initialized to zeros
-    std::vector<uint8_t> current_round_data;
+
+    // Pedersen pre-hash of the current challenge buffer, to which complete chunks are added as the data arrives
+    grumpkin::g1::element buffer_commitment;
+    size_t num_committed_chunks = 0;
+    std::array<uint8_t, BYTES_PER_CHUNK> pending_chunk{};
+    size_t pending_chunk_size = 0;
 
     // "Manifest" object that records a summary of the transcript interactions
     TranscriptManifest manifest;
 
+    /**
+     * @brief Commit to the pending chunk of the challenge buffer and add it to the buffer commitment
+     * @details Mirrors crypto::pedersen_commitment::convert_buffer_to_field: the chunk is read as a big-endian integer
+     * and committed against the default generator indexed by its position in the buffer.
+     */
+    void commit_pending_chunk()
+    {
+        ASSERT(num_committed_chunks < (1 << 16));
+        uint256_t chunk(0);
+        for (size_t i = 0; i < pending_chunk_size; ++i) {
+            chunk = (chunk << uint256_t(8));
+            chunk += uint256_t(pending_chunk[i]);
+        }
+        auto chunk_commitment = crypto::pedersen_commitment::commit_single(grumpkin::fq(chunk),
+                                                                           { 0, num_committed_chunks });
+        buffer_commitment = (num_committed_chunks == 0) ? chunk_commitment : chunk_commitment + buffer_commitment;
+        ++num_committed_chunks;
+        pending_chunk_size = 0;
+    }
+
+    /**
+     * @brief Append bytes to the challenge buffer
+     * @details The Pedersen pre-hash of the buffer is a sum over its 31-byte chunks, so each chunk is committed as soon
+     * as it is complete instead of buffering the whole round. The result is identical to compressing the concatenated
+     * buffer in one go, which keeps challenges in agreement with the recursive verifier.
+     */
+    void absorb(std::span<const uint8_t> bytes)
+    {
+        while (!bytes.empty()) {
+            const size_t num_bytes = std::min(bytes.size(), BYTES_PER_CHUNK - pending_chunk_size);
+            std::copy_n(bytes.begin(), num_bytes, pending_chunk.data() + pending_chunk_size);
+            pending_chunk_size += num_bytes;
+            bytes = bytes.subspan(num_bytes);
+            if (pending_chunk_size == BYTES_PER_CHUNK) {
+                commit_pending_chunk();
+            }
+        }
+    }
+
     /**
      * @brief Compute next challenge c_next = H( Compress(c_prev || round_buffer) )
-     * @details This function computes a new challenge for the current round using the previous challenge
-     * and the current round data, if they are exist. It clears the current_round_data if nonempty after
-     * computing the challenge to minimize how much we compress. It also sets previous_challenge_buffer
-     * to the current challenge buffer to set up next function call.
+     * @details This function computes a new challenge from the challenge buffer, which holds the previous challenge
+     * (if there is one) followed by the round data absorbed since. It then resets the buffer to contain just the new
+     * challenge to set up the next function call.
      * @return std::array<uint8_t, HASH_OUTPUT_SIZE>
      */
     [[nodiscard]] std::array<uint8_t, HASH_OUTPUT_SIZE> get_next_challenge_buffer()
@@ -92,39 +172,33 @@ template <typename FF> class BaseTranscript {
         // Prevent challenge generation if this is the first challenge we're generating,
         // AND nothing was sent by the prover.
         if (is_first_challenge) {
-            ASSERT(!current_round_data.empty());
+            ASSERT(num_committed_chunks > 0 || pending_chunk_size > 0);
+            is_first_challenge = false;
         }
 
-        // concatenate the previous challenge (if this is not the first challenge) with the current round data.
         // TODO(Adrian): Do we want to use a domain separator as the initial challenge buffer?
         // We could be cheeky and use the hash of the manifest as domain separator, which would prevent us from having
         // to domain separate all the data. (See https://safe-hash.dev)
-        std::vector<uint8_t> full_buffer;
-        if (!is_first_challenge) {
-            // if not the first challenge, we can use the previous_challenge_buffer
-            full_buffer.insert(full_buffer.end(), previous_challenge_buffer.begin(), previous_challenge_buffer.end());
-        } else {
-            // Update is_first_challenge for the future
-            is_first_challenge = false;
-        }
-        if (!current_round_data.empty()) {
-            full_buffer.insert(full_buffer.end(), current_round_data.begin(), current_round_data.end());
-            current_round_data.clear(); // clear the round data buffer since it has been used
-        }
 
-        // Pre-hash the full buffer to minimize the amount of data passed to the cryptographic hash function.
+        // Finish the pre-hash of the buffer to minimize the amount of data passed to the cryptographic hash function.
         // Only a collision-resistant hash-function like Pedersen is required for this step.
         // Note: this pre-hashing is an efficiency trick that may be discareded if using a SNARK-friendly or in contexts
         // (eg smart contract verification) where the cost of elliptic curve operations is high.
-        std::vector<uint8_t> compressed_buffer = to_buffer(crypto::pedersen_commitment::compress_native(full_buffer));
+        if (pending_chunk_size > 0) {
+            commit_pending_chunk();
+        }
+        grumpkin::fq compressed_buffer = buffer_commitment.is_point_at_infinity()
+                                             ? grumpkin::fq(0)
+                                             : grumpkin::g1::affine_element(buffer_commitment).x;
 
         // Use a strong hash function to derive the new challenge_buffer.
-        auto base_hash = blake3::blake3s(compressed_buffer);
+        auto base_hash = blake3::blake3s(to_buffer(compressed_buffer));
 
         std::array<uint8_t, HASH_OUTPUT_SIZE> new_challenge_buffer;
         std::copy_n(base_hash.begin(), HASH_OUTPUT_SIZE, new_challenge_buffer.begin());
-        // update previous challenge buffer for next time we call this function
-        previous_challenge_buffer = new_challenge_buffer;
+        // start the next buffer with this challenge
+        num_committed_chunks = 0;
+        absorb(new_challenge_buffer);
         return new_challenge_buffer;
     };
 
@@ -135,12 +209,14 @@ template <typename FF> class BaseTranscript {
      * @param label of the element sent
      * @param element_bytes serialized
      */
-    void consume_prover_element_bytes(const std::string& label, std::span<const uint8_t> element_bytes)
+    void consume_prover_element_bytes(std::string_view label, std::span<const uint8_t> element_bytes)
     {
         // Add an entry to the current round of the manifest
-        manifest.add_entry(round_number, label, element_bytes.size());
+        if (TranscriptManifest::enabled) {
+            manifest.add_entry(round_number, std::string(label), element_bytes.size());
+        }
 
-        current_round_data.insert(current_round_data.end(), element_bytes.begin(), element_bytes.end());
+        absorb(element_bytes);
     }
 
   public:
@@ -160,7 +236,9 @@ template <typename FF> class BaseTranscript {
         constexpr size_t num_challenges = sizeof...(Strings);
 
         // Add challenge labels for current round to the manifest
-        manifest.add_challenge(round_number, labels...);
+        if (TranscriptManifest::enabled) {
+            manifest.add_challenge(round_number, labels...);
+        }
 
         // Compute the new challenge buffer from which we derive the challenges.
 
@@ -186,7 +264,18 @@ template <typename FF> class BaseTranscript {
         return challenges;
     }
 
-    FF get_challenge(const std::string& label) { return get_challenges(label)[0]; }
+    FF get_challenge(std::string_view label) { return get_challenges(label)[0]; }
+
+    /**
+     * @brief Get the challenge labelled `label` followed by `label_index`, building the label only if it is recorded
+     */
+    FF get_challenge(std::string_view label, size_t label_index)
+    {
+        if (TranscriptManifest::enabled) {
+            return get_challenges(TranscriptManifest::indexed_label(label, label_index))[0];
+        }
+        return get_challenges(label)[0];
+    }
 
     [[nodiscard]] TranscriptManifest get_manifest() const { return manifest; };
 
@@ -211,7 +300,7 @@ template <typename FF> class ProverTranscript : public BaseTranscript<FF> {
      * serializable.
      *
      */
-    template <class T> void send_to_verifier(const std::string& label, const T& element)
+    template <class T> void send_to_verifier(std::string_view label, const T& element)
     {
         using serialize::write;
         // TODO(Adrian): Ensure that serialization of affine elements (including point at infinity) is consistent.
@@ -223,6 +312,19 @@ template <typename FF> class ProverTranscript : public BaseTranscript<FF> {
         BaseTranscript<FF>::consume_prover_element_bytes(label, element_bytes);
     }
 
+    /**
+     * @brief Adds a prover message labelled `label` followed by `label_index`, building the label only if it is
+     * recorded in the manifest.
+     */
+    template <class T> void send_to_verifier(std::string_view label, size_t label_index, const T& element)
+    {
+        if (TranscriptManifest::enabled) {
+            send_to_verifier(TranscriptManifest::indexed_label(label, label_index), element);
+        } else {
+            send_to_verifier(label, element);
+        }
+    }
+
     /**
      * @brief For testing: initializes transcript with some arbitrary data so that a challenge can be generated after
      * initialization
@@ -271,7 +373,7 @@ template <class FF> class VerifierTranscript : public BaseTranscript<FF> {
      * @param label Human readable name for the challenge.
      * @return deserialized element of type T
      */
-    template <class T> T receive_from_prover(const std::string& label)
+    template <class T> T receive_from_prover(std::string_view label)
     {
         constexpr size_t element_size = sizeof(T);
         ASSERT(num_bytes_read_ + element_size <= proof_data_.size());
@@ -285,5 +387,17 @@ template <class FF> class VerifierTranscript : public BaseTranscript<FF> {
 
         return element;
     }
+
+    /**
+     * @brief Reads the next element of type `T` labelled `label` followed by `label_index`, building the label only if
+     * it is recorded in the manifest.
+     */
+    template <class T> T receive_from_prover(std::string_view label, size_t label_index)
+    {
+        if (TranscriptManifest::enabled) {
+            return receive_from_prover<T>(TranscriptManifest::indexed_label(label, label_index));
+        }
+        return receive_from_prover<T>(label);
+    }
 };
 } // namespace proof_system::honk
@@ -10,7 +10,16 @@ using namespace proof_system::honk;
 
 class UltraTranscriptTests : public ::testing::Test {
   public:
-    static void SetUpTestSuite() { barretenberg::srs::init_crs_factory("../srs_db/ignition"); }
+    static void SetUpTestSuite()
+    {
+        barretenberg::srs::init_crs_factory("../srs_db/ignition");
+        manifest_was_enabled = TranscriptManifest::enabled;
+        TranscriptManifest::enabled = true;
+    }
+
+    static void TearDownTestSuite() { TranscriptManifest::enabled = manifest_was_enabled; }
+
+    static inline bool manifest_was_enabled = false;
 
     using Flavor = proof_system::honk::flavor::Ultra;
     using FF = Flavor::FF;
@@ -204,6 +213,44 @@ TEST_F(UltraTranscriptTests, ChallengeGenerationTest)
     ASSERT_NE(b, 0) << "Challenge a is 0";
 }
 
+/**
+ * @brief Check that absorbing data as it is sent gives the same challenges as pre-hashing the whole buffer at once,
+ * which is what the recursive verifier expects
+ */
+TEST_F(UltraTranscriptTests, StreamingMatchesBufferedHashing)
+{
+    const auto hash_buffer = [](const std::vector<uint8_t>& buffer) {
+        auto hash = blake3::blake3s(to_buffer(crypto::pedersen_commitment::compress_native(buffer)));
+        return std::vector<uint8_t>(hash.begin(), hash.begin() + ProverTranscript<FF>::HASH_OUTPUT_SIZE);
+    };
+    const auto to_challenge = [](const std::vector<uint8_t>& challenge_buffer) {
+        std::array<uint8_t, sizeof(FF)> field_element_buffer{};
+        std::copy_n(challenge_buffer.begin(), 16, field_element_buffer.begin() + 16);
+        return from_buffer<FF>(field_element_buffer);
+    };
+    const auto concatenate = [](std::vector<uint8_t> lhs, const std::vector<uint8_t>& rhs) {
+        lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+        return lhs;
+    };
+
+    // Rounds of 40, 32 and 64 bytes, which end both on and off 31-byte chunk boundaries
+    auto transcript = ProverTranscript<FF>::init_empty();
+    const FF element = FF::random_element();
+    transcript.send_to_verifier("element", element);
+    transcript.send_to_verifier("size", uint32_t(7));
+    auto [a, b] = transcript.get_challenges("a", "b");
+    transcript.send_to_verifier("element", element);
+    auto c = transcript.get_challenge("c");
+
+    auto buffer_a = hash_buffer(concatenate(concatenate(to_buffer(uint32_t(42)), to_buffer(element)),
+                                            to_buffer(uint32_t(7))));
+    auto buffer_b = hash_buffer(buffer_a);
+    auto buffer_c = hash_buffer(concatenate(buffer_b, to_buffer(element)));
+    EXPECT_EQ(a, to_challenge(buffer_a));
+    EXPECT_EQ(b, to_challenge(buffer_b));
+    EXPECT_EQ(c, to_challenge(buffer_c));
+}
+
 TEST_F(UltraTranscriptTests, FoldingManifestTest)
 {
     using Flavor = flavor::Ultra;
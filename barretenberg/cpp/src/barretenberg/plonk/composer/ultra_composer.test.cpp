@@ -849,4 +849,76 @@ TEST(ultra_plonk_composer, range_constraint_small_variable)
     EXPECT_EQ(result, true);
 }
 
+TEST(ultra_plonk_composer, verify_proofs)
+{
+    barretenberg::srs::init_crs_factory("../srs_db/ignition");
+
+    // Proofs of the same circuit with different witnesses, all checked against one verification key
+    constexpr size_t num_proofs = 6;
+    std::vector<UltraCircuitBuilder> builders(num_proofs);
+    std::vector<UltraComposer> composers(num_proofs);
+    std::vector<plonk::proof> proofs;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        fr a = fr::random_element();
+        fr b = fr::random_element();
+        uint32_t a_idx = builders[i].add_public_variable(a);
+        uint32_t b_idx = builders[i].add_variable(b);
+        uint32_t c_idx = builders[i].add_variable(a + b);
+        builders[i].create_add_gate({ a_idx, b_idx, c_idx, fr::one(), fr::one(), fr::neg_one(), fr::zero() });
+
+        auto prover = composers[i].create_prover(builders[i]);
+        proofs.push_back(prover.construct_proof());
+    }
+    auto verifier = composers[0].create_verifier(builders[0]);
+
+    EXPECT_EQ(verifier.verify_proofs(proofs), std::vector<bool>(num_proofs, true));
+
+    // Damage an evaluation in two of the proofs. The batch check fails, and the fallback finds exactly those two.
+    for (const size_t i : { 1UL, 4UL }) {
+        proofs[i].proof_data[proofs[i].proof_data.size() - 129] ^= 1;
+        EXPECT_FALSE(verifier.verify_proof(proofs[i]));
+    }
+    EXPECT_EQ(verifier.verify_proofs(proofs), std::vector<bool>({ true, false, true, true, false, true }));
+    EXPECT_TRUE(verifier.verify_proof(proofs[5]));
+}
+
+TEST(ultra_plonk_composer, verify_proofs_with_malformed_points)
+{
+    barretenberg::srs::init_crs_factory("../srs_db/ignition");
+
+    constexpr size_t num_proofs = 5;
+    std::vector<UltraCircuitBuilder> builders(num_proofs);
+    std::vector<UltraComposer> composers(num_proofs);
+    std::vector<plonk::proof> proofs;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        fr a = fr::random_element();
+        fr b = fr::random_element();
+        uint32_t a_idx = builders[i].add_public_variable(a);
+        uint32_t b_idx = builders[i].add_variable(b);
+        uint32_t c_idx = builders[i].add_variable(a + b);
+        builders[i].create_add_gate({ a_idx, b_idx, c_idx, fr::one(), fr::one(), fr::neg_one(), fr::zero() });
+
+        auto prover = composers[i].create_prover(builders[i]);
+        proofs.push_back(prover.construct_proof());
+    }
+    auto verifier = composers[0].create_verifier(builders[0]);
+
+    // The proof data starts with the public input and [W_1], and ends with [W_z] and [W_zω]
+    proofs[0].proof_data[32 + 63] ^= 1;
+    auto& proof_data = proofs[2].proof_data;
+    g1::affine_element::serialize_to_buffer(g1::affine_element::infinity(), &proof_data[proof_data.size() - 64]);
+    proofs[3].proof_data.pop_back();
+
+    // Malformed proofs are reported as invalid, without failing the rest of the batch
+    EXPECT_EQ(verifier.verify_proofs(proofs), std::vector<bool>({ false, true, false, false, true }));
+    EXPECT_FALSE(verifier.verify_proof(proofs[0]));
+    EXPECT_FALSE(verifier.verify_proof(proofs[2]));
+
+    // The aggregated points of a recursive proof are read from the public inputs. Built from the one public input
+    // they are not on the curve.
+    verifier.key->contains_recursive_proof = true;
+    verifier.key->recursive_proof_public_input_indices = std::vector<uint32_t>(16, 0);
+    EXPECT_FALSE(verifier.verify_proof(proofs[1]));
+}
+
 } // namespace proof_system::plonk::test_ultra_plonk_composer
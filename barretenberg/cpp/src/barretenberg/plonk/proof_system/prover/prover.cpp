@@ -364,13 +364,7 @@ template <typename settings> void ProverBase<settings>::execute_fourth_round()
     // Compute FFT of lagrange polynomial L_1 (needed in random widgets only)
     compute_lagrange_1_fft();
 
-    for (auto& widget : random_widgets) {
-        alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
-    }
-
-    for (auto& widget : transition_widgets) {
-        alpha_base = widget->compute_quotient_contribution(alpha_base, transcript);
-    }
+    compute_quotient_contributions(alpha_base);
 
     // The parts of the quotient polynomial t(X) are stored as 4 separate polynomials in
     // the code. However, operations such as dividing by the pseudo vanishing polynomial
@@ -399,6 +393,52 @@ template <typename settings> void ProverBase<settings>::execute_fourth_round()
     compute_quotient_commitments();
 } // namespace proof_system::plonk
 
+/**
+ * @brief Add the contributions of all widgets to the quotient polynomial parts, in coset FFT form
+ *
+ * @details Rather than each widget sweeping the whole large domain in turn, each thread walks its share of the domain
+ * in tiles of quotient_tile_size rows and evaluates every widget on a tile before moving to the next one. The wire and
+ * selector coset FFTs used by several widgets, as well as the quotient parts being accumulated, then stay in cache
+ * between widgets. Widgets are evaluated in the same order as before (random widgets first, starting with the
+ * permutation widget, which initialises the quotient parts), so the result is unchanged.
+ *
+ * @return The power of α following the last widget
+ */
+template <typename settings> fr ProverBase<settings>::compute_quotient_contributions(const fr& alpha_base)
+{
+    fr next_alpha_base = alpha_base;
+    for (auto& widget : random_widgets) {
+        next_alpha_base = widget->begin_quotient_contribution(next_alpha_base, transcript);
+    }
+    for (auto& widget : transition_widgets) {
+        next_alpha_base = widget->begin_quotient_contribution(next_alpha_base, transcript);
+    }
+
+    // Each row of the small domain spans four consecutive rows of the large domain, which the threads must not split
+    ASSERT(key->large_domain.thread_size % 4 == 0);
+    parallel_for(key->large_domain.num_threads, [&](size_t j) {
+        const size_t start = j * key->large_domain.thread_size;
+        const size_t end = (j + 1) * key->large_domain.thread_size;
+        for (size_t tile_start = start; tile_start < end; tile_start += quotient_tile_size) {
+            const size_t tile_end = std::min(tile_start + quotient_tile_size, end);
+            for (auto& widget : random_widgets) {
+                widget->accumulate_quotient_contribution(tile_start, tile_end);
+            }
+            for (auto& widget : transition_widgets) {
+                widget->accumulate_quotient_contribution(tile_start, tile_end);
+            }
+        }
+    });
+
+    for (auto& widget : random_widgets) {
+        widget->end_quotient_contribution();
+    }
+    for (auto& widget : transition_widgets) {
+        widget->end_quotient_contribution();
+    }
+    return next_alpha_base;
+}
+
 template <typename settings> void ProverBase<settings>::execute_fifth_round()
 {
     queue.flush_queue();
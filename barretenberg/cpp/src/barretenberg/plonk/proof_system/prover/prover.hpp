@@ -38,6 +38,7 @@ template <typename settings> class ProverBase {
     void compute_quotient_evaluation();
     void add_blinding_to_quotient_polynomial_parts();
     void compute_lagrange_1_fft();
+    barretenberg::fr compute_quotient_contributions(const barretenberg::fr& alpha_base);
     plonk::proof& export_proof();
     plonk::proof& construct_proof();
 
@@ -95,6 +96,10 @@ template <typename settings> class ProverBase {
 
     work_queue queue;
 
+    // Number of rows of the large domain on which every widget is evaluated before moving on to the next rows, so that
+    // the coset FFTs shared by several widgets are read from memory once rather than once per widget
+    static constexpr size_t quotient_tile_size = 512;
+
   private:
     plonk::proof proof;
 };
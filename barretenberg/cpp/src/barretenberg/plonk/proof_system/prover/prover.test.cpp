@@ -3,11 +3,13 @@
 #include "../widgets/transition_widgets/arithmetic_widget.hpp"
 
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/plonk/proof_system/commitment_scheme/kate_commitment_scheme.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "prover.hpp"
 #include <gtest/gtest.h>
+#include <optional>
 
 /*
 ```
@@ -304,3 +306,62 @@ TEST(prover, compute_quotient_polynomial)
         EXPECT_EQ((state.key->quotient_polynomial_parts[3].at(i) == fr::zero()), true);
     }
 }
+
+TEST(prover, process_queue_fft_after_ifft)
+{
+    size_t n = 1 << 10;
+    plonk::Prover state = prover_helpers::generate_test_data(n);
+    // The preamble round queues IFFTs of the wires. Queue the FFT of w_1 alongside them, so that it has to wait for
+    // the monomial form computed by its IFFT, and an MSM that does not depend on either.
+    state.execute_preamble_round();
+    state.queue.add_to_queue({
+        .work_type = work_queue::WorkType::FFT,
+        .mul_scalars = nullptr,
+        .tag = "w_1",
+        .constant = fr(0),
+        .index = 0,
+    });
+    state.queue.add_to_queue({
+        .work_type = work_queue::WorkType::SCALAR_MULTIPLICATION,
+        .mul_scalars = state.key->polynomial_store.get("w_2_lagrange").data(),
+        .tag = "W_2_LAGRANGE",
+        .constant = n,
+        .index = 0,
+    });
+    std::vector<work_queue::work_item> queued_items = state.queue.get_queue();
+    state.queue.process_queue();
+
+    polynomial expected(state.key->polynomial_store.get("w_1"), 4 * n + 4);
+    expected.coset_fft(state.key->large_domain);
+    polynomial result = state.key->polynomial_store.get("w_1_fft");
+    for (size_t i = 0; i < 4 * n; ++i) {
+        EXPECT_EQ(result[i], expected[i]);
+    }
+
+    // The MSM, which ran alongside the transforms, commits to the same point as a direct pippenger does.
+    polynomial scalars(state.key->polynomial_store.get("w_2_lagrange"));
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> pippenger_state(n);
+    g1::affine_element expected_commitment(scalar_multiplication::pippenger_unsafe<curve::BN254>(
+        scalars.data().get(), state.key->reference_string->get_monomial_points(), n, pippenger_state));
+    g1::affine_element commitment =
+        g1::affine_element::serialize_from_buffer(&state.transcript.get_element("W_2_LAGRANGE")[0]);
+    EXPECT_EQ(commitment, expected_commitment);
+
+    std::vector<work_queue::work_item_timing> timings = state.queue.get_work_item_timings();
+    ASSERT_EQ(timings.size(), queued_items.size());
+    std::optional<uint64_t> ifft_end;
+    for (size_t i = 0; i < timings.size(); ++i) {
+        EXPECT_EQ(timings[i].work_type, queued_items[i].work_type);
+        EXPECT_EQ(timings[i].tag, queued_items[i].tag);
+        EXPECT_LE(timings[i].start_us, timings[i].end_us);
+        if (timings[i].work_type == work_queue::WorkType::IFFT) {
+            ifft_end = timings[i].end_us;
+        }
+    }
+    ASSERT_TRUE(ifft_end.has_value());
+    for (const auto& timing : timings) {
+        if (timing.work_type == work_queue::WorkType::FFT) {
+            EXPECT_GE(timing.start_us, *ifft_end);
+        }
+    }
+}
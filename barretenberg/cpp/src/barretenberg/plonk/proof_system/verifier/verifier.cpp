@@ -1,7 +1,6 @@
 #include "./verifier.hpp"
 #include "../public_inputs/public_inputs.hpp"
 #include "../utils/kate_verification.hpp"
-#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/curves/bn254/fq12.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
@@ -37,6 +36,126 @@ VerifierBase<program_settings>& VerifierBase<program_settings>::operator=(Verifi
 }
 
 template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+{
+    const auto check = reduce_to_pairing_check(proof);
+    return check.has_value() && verify_pairing_checks({ &*check, 1 });
+}
+
+/**
+ * Verifies a batch of proofs against the verification key, returning whether each of them is valid.
+ *
+ * Every proof is reduced to its pairing check, and the checks are combined into one: two MSMs, in which the
+ * verification key commitments are shared by all of the proofs, and a single pairing. If the combined check fails, the
+ * batch is split in halves and each half is checked on its own, down to single proofs, so that a few invalid proofs in
+ * a large batch are found with a number of checks logarithmic in the size of the batch. Malformed proofs, whose size
+ * or group elements are invalid, are reported as invalid without taking part in the combined check.
+ */
+template <typename program_settings>
+std::vector<bool> VerifierBase<program_settings>::verify_proofs(std::span<const plonk::proof> proofs)
+{
+    const size_t proof_size = manifest.get_proof_size();
+    std::vector<PairingCheckInputs> checks;
+    std::vector<size_t> proof_indices;
+    checks.reserve(proofs.size());
+    proof_indices.reserve(proofs.size());
+    for (size_t i = 0; i < proofs.size(); ++i) {
+        if (proofs[i].proof_data.size() != proof_size) {
+            continue;
+        }
+        auto check = reduce_to_pairing_check(proofs[i]);
+        if (check.has_value()) {
+            checks.push_back(std::move(*check));
+            proof_indices.push_back(i);
+        }
+    }
+
+    std::vector<bool> results(proofs.size(), false);
+    const auto isolate_invalid = [&](auto& self, size_t begin, size_t end, bool known_invalid) -> bool {
+        if (!known_invalid && verify_pairing_checks(std::span(checks).subspan(begin, end - begin))) {
+            for (size_t i = begin; i < end; ++i) {
+                results[proof_indices[i]] = true;
+            }
+            return true;
+        }
+        if (end - begin == 1) {
+            return false;
+        }
+        // If the first half is valid, the second half must hold the invalid proofs and need not be checked as a whole.
+        const size_t mid = begin + (end - begin) / 2;
+        const bool first_half_valid = self(self, begin, mid, false);
+        self(self, mid, end, first_half_valid);
+        return false;
+    };
+    if (!checks.empty()) {
+        isolate_invalid(isolate_invalid, 0, checks.size(), false);
+    }
+    return results;
+}
+
+/**
+ * Evaluates the given pairing checks, returning whether all of them hold.
+ *
+ * Several checks are combined with random weights r_i into e(\sum r_i P_{0,i}, [1]_2).e(\sum r_i P_{1,i}, [x]_2) == 1,
+ * which holds only if each of them does, except with negligible probability. Terms of different checks with the same
+ * label and group element, such as the verification key commitments, are merged into a single term of each MSM.
+ */
+template <typename program_settings>
+bool VerifierBase<program_settings>::verify_pairing_checks(std::span<const PairingCheckInputs> checks) const
+{
+    std::vector<fr> weights(checks.size(), fr::one());
+    if (checks.size() > 1) {
+        for (auto& weight : weights) {
+            weight = fr::random_element();
+        }
+    }
+
+    g1::element P[2];
+    for (size_t j = 0; j < 2; ++j) {
+        std::vector<fr> scalars;
+        std::vector<g1::affine_element> elements;
+        std::map<std::string, size_t> term_indices;
+        for (size_t i = 0; i < checks.size(); ++i) {
+            for (const auto& term : checks[i].terms[j]) {
+                const fr scalar = term.scalar * weights[i];
+                const auto [it, inserted] = term_indices.try_emplace(term.label, elements.size());
+                if (!inserted && elements[it->second] == term.element) {
+                    scalars[it->second] += scalar;
+                } else {
+                    scalars.push_back(scalar);
+                    elements.push_back(term.element);
+                }
+            }
+        }
+
+        const size_t num_elements = elements.size();
+        elements.resize(num_elements * 2);
+        barretenberg::scalar_multiplication::generate_pippenger_point_table<curve::BN254>(
+            &elements[0], &elements[0], num_elements);
+        scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_elements);
+        P[j] = barretenberg::scalar_multiplication::pippenger<curve::BN254>(
+            &scalars[0], &elements[0], num_elements, state);
+    }
+
+    g1::element::batch_normalize(P, 2);
+
+    g1::affine_element P_affine[2]{
+        { P[0].x, P[0].y },
+        { P[1].x, P[1].y },
+    };
+
+    // The final pairing check of step 12.
+    barretenberg::fq12 result = barretenberg::pairing::reduced_ate_pairing_batch_precomputed(
+        P_affine, key->reference_string->get_precomputed_g2_lines(), 2);
+
+    return (result == barretenberg::fq12::one());
+}
+
+/**
+ * Reduces a proof to its final pairing check, or returns std::nullopt if one of the group elements of the proof, or of
+ * the recursive proof in its public inputs, is not a valid point.
+ */
+template <typename program_settings>
+std::optional<PairingCheckInputs> VerifierBase<program_settings>::reduce_to_pairing_check(const plonk::proof& proof)
 {
     // This function verifies a PLONK proof for given program settings.
     // A PLONK proof for standard PLONK is of the form:
@@ -48,6 +167,8 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     // Proof π_SNARK must first be added to the transcript with the other program_settings.
 
     key->program_width = program_settings::program_width;
+    kate_g1_elements.clear();
+    kate_fr_elements.clear();
 
     // Add the proof data to the transcript, according to the manifest. Also initialise the transcript's hash type and
     // challenge bytes.
@@ -128,6 +249,15 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     // Note that we do not actually compute the scalar multiplications but just accumulate the scalars
     // and the group elements in different vectors.
     //
+    // The commitment scheme rejects invalid witness commitments by aborting, so they are checked here first.
+    for (const auto& item : key->polynomial_manifest.get()) {
+        if (item.source == PolynomialSource::WITNESS) {
+            const auto element = transcript.get_group_element(std::string(item.commitment_label));
+            if (!element.on_curve() || element.is_point_at_infinity()) {
+                return std::nullopt;
+            }
+        }
+    }
     commitment_scheme->batch_verify(transcript, kate_g1_elements, kate_fr_elements, key);
 
     // Step 9: Compute the partial opening batch commitment [D]_1:
@@ -148,12 +278,11 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     g1::affine_element PI_Z_OMEGA = g1::affine_element::serialize_from_buffer(&transcript.get_element("PI_Z_OMEGA")[0]);
 
     // Validate PI_Z, PI_Z_OMEGA are valid ecc points.
-    // N.B. we check that witness commitments are valid points in KateCommitmentScheme<settings>::batch_verify
     if (!PI_Z.on_curve() || PI_Z.is_point_at_infinity()) {
-        throw_or_abort("opening proof group element PI_Z not a valid point");
+        return std::nullopt;
     }
-    if (!PI_Z_OMEGA.on_curve() || PI_Z.is_point_at_infinity()) {
-        throw_or_abort("opening proof group element PI_Z_OMEGA not a valid point");
+    if (!PI_Z_OMEGA.on_curve() || PI_Z_OMEGA.is_point_at_infinity()) {
+        return std::nullopt;
     }
 
     // Accumulate pairs of scalars and group elements which would be used in the final pairing check.
@@ -163,27 +292,17 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     kate_g1_elements.insert({ "PI_Z", PI_Z });
     kate_fr_elements.insert({ "PI_Z", zeta });
 
-    std::vector<fr> scalars;
-    std::vector<g1::affine_element> elements;
-
-    for (const auto& [key, value] : kate_g1_elements) {
+    // The final pairing check of step 12 is e(P_0, [1]_2).e(P_1, [x]_2) == 1, where P_0 is the MSM of the accumulated
+    // terms and P_1 = -(separator.[W_zω]_1 + [W_z]_1).
+    PairingCheckInputs check;
+    for (const auto& [label, value] : kate_g1_elements) {
         // TODO: perhaps we should throw if not on curve or if infinity?
         if (value.on_curve() && !value.is_point_at_infinity()) {
-            scalars.emplace_back(kate_fr_elements.at(key));
-            elements.emplace_back(value);
+            check.terms[0].push_back({ label, value, kate_fr_elements.at(label) });
         }
     }
-
-    size_t num_elements = elements.size();
-    elements.resize(num_elements * 2);
-    barretenberg::scalar_multiplication::generate_pippenger_point_table<curve::BN254>(
-        &elements[0], &elements[0], num_elements);
-    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_elements);
-
-    g1::element P[2];
-
-    P[0] = barretenberg::scalar_multiplication::pippenger<curve::BN254>(&scalars[0], &elements[0], num_elements, state);
-    P[1] = -(g1::element(PI_Z_OMEGA) * separator_challenge + PI_Z);
+    check.terms[1].push_back({ "PI_Z_OMEGA", PI_Z_OMEGA, -separator_challenge });
+    check.terms[1].push_back({ "PI_Z", PI_Z, -fr::one() });
 
     if (key->contains_recursive_proof) {
         ASSERT(key->recursive_proof_public_input_indices.size() == 16);
@@ -220,22 +339,17 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
                                                       key->recursive_proof_public_input_indices[14],
                                                       key->recursive_proof_public_input_indices[15]);
 
-        P[0] += g1::element(x0, y0, 1) * recursion_separator_challenge;
-        P[1] += g1::element(x1, y1, 1) * recursion_separator_challenge;
+        // The aggregated points come from the public inputs, so they must be validated like the proof's own elements
+        const g1::affine_element P0(x0, y0);
+        const g1::affine_element P1(x1, y1);
+        if (!P0.on_curve() || P0.is_point_at_infinity() || !P1.on_curve() || P1.is_point_at_infinity()) {
+            return std::nullopt;
+        }
+        check.terms[0].push_back({ "RECURSIVE_P0", P0, recursion_separator_challenge });
+        check.terms[1].push_back({ "RECURSIVE_P1", P1, recursion_separator_challenge });
     }
 
-    g1::element::batch_normalize(P, 2);
-
-    g1::affine_element P_affine[2]{
-        { P[0].x, P[0].y },
-        { P[1].x, P[1].y },
-    };
-
-    // The final pairing check of step 12.
-    barretenberg::fq12 result = barretenberg::pairing::reduced_ate_pairing_batch_precomputed(
-        P_affine, key->reference_string->get_precomputed_g2_lines(), 2);
-
-    return (result == barretenberg::fq12::one());
+    return check;
 }
 
 template class VerifierBase<standard_verifier_settings>;
@@ -4,8 +4,24 @@
 #include "../widgets/random_widgets/random_widget.hpp"
 #include "barretenberg/plonk/proof_system/commitment_scheme/commitment_scheme.hpp"
 #include "barretenberg/transcript/manifest.hpp"
+#include <optional>
+#include <span>
 
 namespace proof_system::plonk {
+
+/**
+ * @brief The final pairing check e(P_0, [1]_2).e(P_1, [x]_2) == 1 of a proof, with P_0 and P_1 left as the terms of
+ * their multi-scalar multiplications so that the checks of several proofs can be combined into one
+ */
+struct PairingCheckInputs {
+    struct Term {
+        std::string label;
+        barretenberg::g1::affine_element element;
+        barretenberg::fr scalar;
+    };
+    std::array<std::vector<Term>, 2> terms;
+};
+
 template <typename program_settings> class VerifierBase {
 
   public:
@@ -20,6 +36,11 @@ template <typename program_settings> class VerifierBase {
     bool validate_scalars();
 
     bool verify_proof(const plonk::proof& proof);
+    std::vector<bool> verify_proofs(std::span<const plonk::proof> proofs);
+
+    std::optional<PairingCheckInputs> reduce_to_pairing_check(const plonk::proof& proof);
+    bool verify_pairing_checks(std::span<const PairingCheckInputs> checks) const;
+
     transcript::Manifest manifest;
 
     std::shared_ptr<verification_key> key;
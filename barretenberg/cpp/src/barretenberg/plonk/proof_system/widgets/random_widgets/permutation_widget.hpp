@@ -38,8 +38,28 @@ class ProverPermutationWidget : public ProverRandomWidget {
                                    const size_t round_number,
                                    work_queue& queue) override;
 
-    barretenberg::fr compute_quotient_contribution(const barretenberg::fr& alpha_base,
-                                                   const transcript::StandardTranscript& transcript) override;
+    barretenberg::fr begin_quotient_contribution(const barretenberg::fr& alpha_base,
+                                                 const transcript::StandardTranscript& transcript) override;
+
+    void accumulate_quotient_contribution(size_t start, size_t end) override;
+
+    void end_quotient_contribution() override;
+
+  private:
+    // Inputs of the quotient contribution, loaded by begin_quotient_contribution
+    polynomial z_perm_fft;
+    polynomial l_start;
+    std::array<std::shared_ptr<fr[]>, program_width> wire_ffts_ptr;
+    std::array<std::shared_ptr<fr[]>, program_width> sigma_ffts_ptr;
+    std::array<std::shared_ptr<fr[]>, program_width> id_ffts_ptr;
+    std::array<fr*, program_width> wire_ffts;
+    std::array<fr*, program_width> sigma_ffts;
+    std::array<fr*, program_width> id_ffts;
+    fr quotient_alpha_base;
+    fr alpha_squared;
+    fr beta;
+    fr gamma;
+    fr public_input_delta;
 };
 
 } // namespace proof_system::plonk
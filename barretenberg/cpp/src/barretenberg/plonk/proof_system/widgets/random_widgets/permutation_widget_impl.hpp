@@ -66,7 +66,7 @@ void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanish
     // 'z_perm'. Elements 2,...,n of z_perm are constructed in place in accumulators[0]. (The first
     // element of z_perm is one, i.e. z_perm[0] == 1). The remaining accumulators are used only as scratch
     // space.
-    size_t num_accumulators = (program_width == 1) ? 3 : program_width * 2;
+    size_t num_accumulators = program_width * 2;
     std::shared_ptr<void> accumulators_ptrs[num_accumulators];
     fr* accumulators[num_accumulators];
     // Allocate the required number of length n scratch space arrays
@@ -189,32 +189,9 @@ void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanish
         }
     });
 
-    // Step 2: compute the constituent components of z(X). This is a small multithreading bottleneck, as we have
-    // program_width * 2 non-parallelizable processes
-    //
-    // Update the accumulator matrix a[:][:] to contain the left products like so:
-    //      0           1                     2                          (n-1)
-    // 0 -> (a[0][0]),  (a[0][1] * a[0][0]),  (a[0][2] * a[0][1]), ...,  (a[0][n-1] * a[0][n-2])
-    // 1 -> (a[1][0]),  (a[1][1] * a[1][0]),  (a[1][2] * a[1][1]), ...,  (a[1][n-1] * a[1][n-2])
-    // 2 -> (a[2][0]),  (a[2][1] * a[2][0]),  (a[2][2] * a[2][1]), ...,  (a[2][n-1] * a[2][n-2])
-    //
-    // 3 -> (a[3][0]),  (a[3][1] * a[3][0]),  (a[3][2] * a[3][1]), ...,  (a[3][n-1] * a[3][n-2])
-    // 4 -> (a[4][0]),  (a[4][1] * a[4][0]),  (a[4][2] * a[4][1]), ...,  (a[4][n-1] * a[4][n-2])
-    // 5 -> (a[5][0]),  (a[5][1] * a[5][0]),  (a[5][2] * a[5][1]), ...,  (a[5][n-1] * a[5][n-2])
-    //
-    // and so on...
-    parallel_for(program_width * 2, [&](size_t i) {
-        fr* coeffs = &accumulators[i][0]; // start from the beginning of a row
-        for (size_t j = 0; j < key->small_domain.size - 1; ++j) {
-            coeffs[j + 1] *= coeffs[j]; // iteratively update elements in subsequent columns
-        }
-    });
-
-    // step 3: concatenate together the accumulator elements into z(X)
-    //
-    // Update each element of the accumulator row a[0] to be the product of itself with the 'numerator' rows beneath
-    // it, and update each element of a[program_width] to be the product of itself with the 'denominator' rows
-    // beneath it.
+    // Step 2: multiply the rows of the accumulator matrix together, so that each element of the accumulator row a[0]
+    // is the product of itself with the 'numerator' rows beneath it, and each element of a[program_width] is the
+    // product of itself with the 'denominator' rows beneath it.
     //
     //       0                                     1                                           (n-1)
     // 0 ->  (a[0][0] * a[1][0] * a[2][0]),        (a[0][1] * a[1][1] * a[2][1]),        ...., (a[0][n-1] *
@@ -224,40 +201,28 @@ void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanish
     // a[pw+1][n-1] * a[pw+2][n-1])
     //
     // Note that pw = program_width
-    //
-    // Hereafter, we can compute
-    // coefficient_Lj = a[0][j]/a[pw][j]
-    //
-    // Naive way of computing these coefficients would result in n inversions, which is pretty expensive.
-    // Instead we use Montgomery's trick for batch inversion.
-    // Montgomery's trick documentation:
-    // ./src/barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp/L286
     parallel_for(key->small_domain.num_threads, [&](size_t j) {
         const size_t start = j * key->small_domain.thread_size;
-        const size_t end =
-            ((j + 1) * key->small_domain.thread_size) - ((j == key->small_domain.num_threads - 1) ? 1 : 0);
-        barretenberg::fr inversion_accumulator = fr::one();
-        constexpr size_t inversion_index = (program_width == 1) ? 2 : program_width * 2 - 1;
-        fr* inversion_coefficients = &accumulators[inversion_index][0];
+        const size_t end = (j + 1) * key->small_domain.thread_size;
         for (size_t i = start; i < end; ++i) {
-
             for (size_t k = 1; k < program_width; ++k) {
                 accumulators[0][i] *= accumulators[k][i];
                 accumulators[program_width][i] *= accumulators[program_width + k][i];
             }
-            inversion_coefficients[i] = accumulators[0][i] * inversion_accumulator;
-            inversion_accumulator *= accumulators[program_width][i];
-        }
-        inversion_accumulator = inversion_accumulator.invert();
-        for (size_t i = end - 1; i != start - 1; --i) {
-
-            // N.B. accumulators[0][i] = z_perm[i + 1]
-            // We can avoid fully reducing z_perm[i + 1] as the inverse fft will take care of that for us
-            accumulators[0][i] = inversion_accumulator * inversion_coefficients[i];
-            inversion_accumulator *= accumulators[program_width][i];
         }
     });
 
+    // Step 3: compute the coefficients of z(X),
+    // a[0][j] <- ∏_{i ≤ j} a[0][i] / a[pw][i]
+    //
+    // The running products and the division are fused into one parallel scan, which uses Montgomery's trick for
+    // batch inversion with a single inversion per thread.
+    // Montgomery's trick documentation:
+    // ./src/barretenberg/ecc/curves/bn254/scalar_multiplication/scalar_multiplication.hpp/L286
+    barretenberg::polynomial_arithmetic::compute_prefix_quotients(
+        std::span<fr>{ accumulators[0], key->circuit_size - 1 },
+        std::span<const fr>{ accumulators[program_width], key->circuit_size - 1 });
+
     // Construct permutation polynomial 'z' in lagrange form as:
     // z = [1 accumulators[0][0] accumulators[0][1] ... accumulators[0][n-2]]
     polynomial z_perm(key->circuit_size);
@@ -338,13 +303,14 @@ void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanish
 
 template <size_t program_width, bool idpolys, const size_t num_roots_cut_out_of_vanishing_polynomial>
 barretenberg::fr ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanishing_polynomial>::
-    compute_quotient_contribution(const fr& alpha_base, const transcript::StandardTranscript& transcript)
+    begin_quotient_contribution(const fr& alpha_base, const transcript::StandardTranscript& transcript)
 {
-    const polynomial& z_perm_fft = key->polynomial_store.get("z_perm_fft");
+    z_perm_fft = key->polynomial_store.get("z_perm_fft");
 
-    barretenberg::fr alpha_squared = alpha_base.sqr();
-    barretenberg::fr beta = fr::serialize_from_buffer(transcript.get_challenge("beta").begin());
-    barretenberg::fr gamma = fr::serialize_from_buffer(transcript.get_challenge("beta", 1).begin());
+    quotient_alpha_base = alpha_base;
+    alpha_squared = alpha_base.sqr();
+    beta = fr::serialize_from_buffer(transcript.get_challenge("beta").begin());
+    gamma = fr::serialize_from_buffer(transcript.get_challenge("beta", 1).begin());
 
     // Initialise the (n + 1)th coefficients of quotient parts so that reuse of proving
     // keys does not use some residual data from another proof.
@@ -369,14 +335,6 @@ barretenberg::fr ProverPermutationWidget<program_width, idpolys, num_roots_cut_o
     // (w_l(X) + β.σ_1(X) + γ).(w_r(X) + β.σ_2(X) + γ).(w_o(X) + β.σ_3(X) + γ).z(X).α
     // Once we divide by the vanishing polynomial, this will be a degree 3n polynomial. (4 * (n-1) - (n-4)).
 
-    std::array<std::shared_ptr<fr[]>, program_width> wire_ffts_ptr;
-    std::array<std::shared_ptr<fr[]>, program_width> sigma_ffts_ptr;
-    [[maybe_unused]] std::array<std::shared_ptr<fr[]>, program_width> id_ffts_ptr;
-
-    std::array<fr*, program_width> wire_ffts;
-    std::array<fr*, program_width> sigma_ffts;
-    [[maybe_unused]] std::array<fr*, program_width> id_ffts;
-
     for (size_t i = 0; i < program_width; ++i) {
 
         // wire_fft[0] contains the fft of the wire polynomial w_1
@@ -396,141 +354,149 @@ barretenberg::fr ProverPermutationWidget<program_width, idpolys, num_roots_cut_o
     }
 
     // we start with lagrange polynomial L_1(X)
-    const polynomial& l_start = key->polynomial_store.get("lagrange_1_fft");
+    l_start = key->polynomial_store.get("lagrange_1_fft");
 
     // Compute our public input component
     std::vector<barretenberg::fr> public_inputs = many_from_buffer<fr>(transcript.get_element("public_inputs"));
 
-    barretenberg::fr public_input_delta =
-        compute_public_input_delta<fr>(public_inputs, beta, gamma, key->small_domain.root);
-
-    const size_t block_mask = key->large_domain.size - 1;
-    // Step 4: Set the quotient polynomial to be equal to
-    parallel_for(key->large_domain.num_threads, [&](size_t j) {
-        const size_t start = j * key->large_domain.thread_size;
-        const size_t end = (j + 1) * key->large_domain.thread_size;
-
-        // Leverage multi-threading by computing quotient polynomial at points
-        // (ω^{j * num_threads}, ω^{j * num_threads + 1}, ..., ω^{j * num_threads + num_threads})
-        //
-        // curr_root = ω^{j * num_threads} * g_{small} * β
-        // curr_root will be used in denominator
-        barretenberg::fr cur_root_times_beta =
-            key->large_domain.root.pow(static_cast<uint64_t>(j * key->large_domain.thread_size));
-        cur_root_times_beta *= key->small_domain.generator;
-        cur_root_times_beta *= beta;
+    public_input_delta = compute_public_input_delta<fr>(public_inputs, beta, gamma, key->small_domain.root);
 
-        barretenberg::fr wire_plus_gamma;
-        barretenberg::fr T0;
-        barretenberg::fr denominator;
-        barretenberg::fr numerator;
-        for (size_t i = start; i < end; ++i) {
-            wire_plus_gamma = gamma + wire_ffts[0][i];
+    return alpha_base.sqr().sqr();
+}
 
-            // Numerator computation
+template <size_t program_width, bool idpolys, const size_t num_roots_cut_out_of_vanishing_polynomial>
+void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanishing_polynomial>::
+    accumulate_quotient_contribution(const size_t start, const size_t end)
+{
+    const size_t block_mask = key->large_domain.size - 1;
+    // Compute the quotient polynomial at points (ω^{start}, ω^{start + 1}, ..., ω^{end - 1})
+    //
+    // curr_root = ω^{start} * g_{small} * β
+    // curr_root will be used in denominator
+    barretenberg::fr cur_root_times_beta = key->large_domain.root.pow(static_cast<uint64_t>(start));
+    cur_root_times_beta *= key->small_domain.generator;
+    cur_root_times_beta *= beta;
+
+    barretenberg::fr wire_plus_gamma;
+    barretenberg::fr T0;
+    barretenberg::fr denominator;
+    barretenberg::fr numerator;
+    for (size_t i = start; i < end; ++i) {
+        wire_plus_gamma = gamma + wire_ffts[0][i];
+
+        // Numerator computation
+        if constexpr (!idpolys)
+            // identity polynomial used as a monomial: S_{id1} = x, S_{id2} = k_1.x, S_{id3} = k_2.x
+            // start with (w_l(X) + β.X + γ)
+            numerator = cur_root_times_beta + wire_plus_gamma;
+        else
+            numerator = id_ffts[0][i] * beta + wire_plus_gamma;
+
+        // Denominator computation
+        // start with (w_l(X) + β.σ_1(X) + γ)
+        denominator = sigma_ffts[0][i] * beta;
+        denominator += wire_plus_gamma;
+
+        for (size_t k = 1; k < program_width; ++k) {
+            wire_plus_gamma = gamma + wire_ffts[k][i];
             if constexpr (!idpolys)
-                // identity polynomial used as a monomial: S_{id1} = x, S_{id2} = k_1.x, S_{id3} = k_2.x
-                // start with (w_l(X) + β.X + γ)
-                numerator = cur_root_times_beta + wire_plus_gamma;
-            else
-                numerator = id_ffts[0][i] * beta + wire_plus_gamma;
-
-            // Denominator computation
-            // start with (w_l(X) + β.σ_1(X) + γ)
-            denominator = sigma_ffts[0][i] * beta;
-            denominator += wire_plus_gamma;
+                // (w_r(X) + β.(k_{k}.X) + γ)
+                T0 = fr::coset_generator(k - 1) * cur_root_times_beta;
+            if constexpr (idpolys)
+                T0 = id_ffts[k][i] * beta;
+
+            T0 += wire_plus_gamma;
+            numerator *= T0;
+
+            // (w_r(X) + β.σ_{k}(X) + γ)
+            T0 = sigma_ffts[k][i] * beta;
+            T0 += wire_plus_gamma;
+            denominator *= T0;
+        }
 
-            for (size_t k = 1; k < program_width; ++k) {
-                wire_plus_gamma = gamma + wire_ffts[k][i];
-                if constexpr (!idpolys)
-                    // (w_r(X) + β.(k_{k}.X) + γ)
-                    T0 = fr::coset_generator(k - 1) * cur_root_times_beta;
-                if constexpr (idpolys)
-                    T0 = id_ffts[k][i] * beta;
-
-                T0 += wire_plus_gamma;
-                numerator *= T0;
-
-                // (w_r(X) + β.σ_{k}(X) + γ)
-                T0 = sigma_ffts[k][i] * beta;
-                T0 += wire_plus_gamma;
-                denominator *= T0;
-            }
+        numerator *= z_perm_fft[i];
+        denominator *= z_perm_fft[(i + 4) & block_mask];
+
+        /**
+         * Permutation bounds check
+         * (z(X.w) - 1).(α^3).L_{end}(X) = T(X).Z*_H(X)
+         *
+         * where Z*_H(X) = (X^n - 1)/[(X - ω^{n-1})...(X - ω^{n - num_roots_cut_out_of_vanishing_polynomial})]
+         * i.e. we remove some roots from the true vanishing polynomial to ensure that the overall degree
+         * of the permutation polynomial is <= n.
+         * Read more on this here: https://hackmd.io/1DaroFVfQwySwZPHMoMdBg
+         *
+         * Therefore, L_{end} = L_{n - num_roots_cut_out_of_vanishing_polynomial}
+         **/
+        // The α^3 term is so that we can subsume this polynomial into the quotient polynomial,
+        // whilst ensuring the term is linearly independent form the other terms in the quotient polynomial
+
+        // We want to verify that z(X) equals `1` when evaluated at `ω_n`, the 'last' element of our
+        // multiplicative subgroup H. But PLONK's 'vanishing polynomial', Z*_H(X), isn't the true vanishing
+        // polynomial of subgroup H. We need to cut a root of unity out of Z*_H(X), specifically `ω_n`, for our
+        // grand product argument. When evaluating z(X) has been constructed correctly, we verify that
+        // z(X.ω).(identity permutation product) = z(X).(sigma permutation product), for all X \in H. But this
+        // relationship breaks down for X = ω_n, because z(X.ω) will evaluate to the *first* element of our
+        // grand product argument. The last element of z(X) has a dependency on the first element, so the first
+        // element cannot have a dependency on the last element.
+
+        // TODO: With the reduction from 2 z polynomials to a single z(X), the above no longer applies
+        // TODO: Fix this to remove the (z(X.ω) - 1).L_{n-1}(X) check
+
+        // To summarise, we can't verify claims about z(X) when evaluated at `ω_n`.
+        // But we can verify claims about z(X.ω) when evaluated at `ω_{n-1}`, which is the same thing
+
+        // To summarise the summary: If z(ω_n) = 1, then (z(X.ω) - 1).L_{n-1}(X) will be divisible by Z_H*(X)
+        // => add linearly independent term (z(X.ω) - 1).(α^3).L{n-1}(X) into the quotient polynomial to check
+        // this
+
+        // z_perm_fft already contains evaluations of Z(X).(\alpha^2)
+        // at the (4n)'th roots of unity
+        // => to get Z(X.w) instead of Z(X), index element (i+4) instead of i
+        T0 = z_perm_fft[(i + 4) & block_mask] - public_input_delta; // T0 = (Z(X.w) - (delta)).(\alpha^2)
+        T0 *= quotient_alpha_base;                                  // T0 = (Z(X.w) - (delta)).(\alpha^3)
+
+        // T0 = (z(X.ω) - Δ).(α^3).L_{end}
+        // where L_{end} = L{n - num_roots_cut_out_of_vanishing_polynomial}.
+        //
+        // Note that L_j(X) = L_1(X . ω^{-j}) = L_1(X . ω^{n-j})
+        // => L_{end}= L_1(X . ω^{num_roots_cut_out_of_vanishing_polynomial + 1})
+        // => fetch the value at index (i + (num_roots_cut_out_of_vanishing_polynomial + 1) * 4) in l_1
+        // the factor of 4 is because l_1 is a 4n-size fft.
+        //
+        // Recall, we use l_start for l_1 for consistency in notation.
+        T0 *= l_start[(i + 4 + 4 * num_roots_cut_out_of_vanishing_polynomial) & block_mask];
+        numerator += T0;
+
+        // Step 2: Compute (z(X) - 1).(α^4).L1(X)
+        // We need to verify that z(X) equals `1` when evaluated at the first element of our subgroup H
+        // i.e. z(X) starts at 1 and ends at 1
+        // The `alpha^4` term is so that we can add this as a linearly independent term in our quotient
+        // polynomial
+        T0 = z_perm_fft[i] - fr(1); // T0 = (Z(X) - 1).(\alpha^2)
+        T0 *= alpha_squared;        // T0 = (Z(X) - 1).(\alpha^4)
+        T0 *= l_start[i];           // T0 = (Z(X) - 1).(\alpha^2).L1(X)
+        numerator += T0;
+
+        // Combine into quotient polynomial
+        T0 = numerator - denominator;
+        key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)] =
+            T0 * quotient_alpha_base;
+
+        // Update our working root of unity
+        cur_root_times_beta *= key->large_domain.root;
+    }
+}
 
-            numerator *= z_perm_fft[i];
-            denominator *= z_perm_fft[(i + 4) & block_mask];
-
-            /**
-             * Permutation bounds check
-             * (z(X.w) - 1).(α^3).L_{end}(X) = T(X).Z*_H(X)
-             *
-             * where Z*_H(X) = (X^n - 1)/[(X - ω^{n-1})...(X - ω^{n - num_roots_cut_out_of_vanishing_polynomial})]
-             * i.e. we remove some roots from the true vanishing polynomial to ensure that the overall degree
-             * of the permutation polynomial is <= n.
-             * Read more on this here: https://hackmd.io/1DaroFVfQwySwZPHMoMdBg
-             *
-             * Therefore, L_{end} = L_{n - num_roots_cut_out_of_vanishing_polynomial}
-             **/
-            // The α^3 term is so that we can subsume this polynomial into the quotient polynomial,
-            // whilst ensuring the term is linearly independent form the other terms in the quotient polynomial
-
-            // We want to verify that z(X) equals `1` when evaluated at `ω_n`, the 'last' element of our
-            // multiplicative subgroup H. But PLONK's 'vanishing polynomial', Z*_H(X), isn't the true vanishing
-            // polynomial of subgroup H. We need to cut a root of unity out of Z*_H(X), specifically `ω_n`, for our
-            // grand product argument. When evaluating z(X) has been constructed correctly, we verify that
-            // z(X.ω).(identity permutation product) = z(X).(sigma permutation product), for all X \in H. But this
-            // relationship breaks down for X = ω_n, because z(X.ω) will evaluate to the *first* element of our
-            // grand product argument. The last element of z(X) has a dependency on the first element, so the first
-            // element cannot have a dependency on the last element.
-
-            // TODO: With the reduction from 2 z polynomials to a single z(X), the above no longer applies
-            // TODO: Fix this to remove the (z(X.ω) - 1).L_{n-1}(X) check
-
-            // To summarise, we can't verify claims about z(X) when evaluated at `ω_n`.
-            // But we can verify claims about z(X.ω) when evaluated at `ω_{n-1}`, which is the same thing
-
-            // To summarise the summary: If z(ω_n) = 1, then (z(X.ω) - 1).L_{n-1}(X) will be divisible by Z_H*(X)
-            // => add linearly independent term (z(X.ω) - 1).(α^3).L{n-1}(X) into the quotient polynomial to check
-            // this
-
-            // z_perm_fft already contains evaluations of Z(X).(\alpha^2)
-            // at the (4n)'th roots of unity
-            // => to get Z(X.w) instead of Z(X), index element (i+4) instead of i
-            T0 = z_perm_fft[(i + 4) & block_mask] - public_input_delta; // T0 = (Z(X.w) - (delta)).(\alpha^2)
-            T0 *= alpha_base;                                           // T0 = (Z(X.w) - (delta)).(\alpha^3)
-
-            // T0 = (z(X.ω) - Δ).(α^3).L_{end}
-            // where L_{end} = L{n - num_roots_cut_out_of_vanishing_polynomial}.
-            //
-            // Note that L_j(X) = L_1(X . ω^{-j}) = L_1(X . ω^{n-j})
-            // => L_{end}= L_1(X . ω^{num_roots_cut_out_of_vanishing_polynomial + 1})
-            // => fetch the value at index (i + (num_roots_cut_out_of_vanishing_polynomial + 1) * 4) in l_1
-            // the factor of 4 is because l_1 is a 4n-size fft.
-            //
-            // Recall, we use l_start for l_1 for consistency in notation.
-            T0 *= l_start[(i + 4 + 4 * num_roots_cut_out_of_vanishing_polynomial) & block_mask];
-            numerator += T0;
-
-            // Step 2: Compute (z(X) - 1).(α^4).L1(X)
-            // We need to verify that z(X) equals `1` when evaluated at the first element of our subgroup H
-            // i.e. z(X) starts at 1 and ends at 1
-            // The `alpha^4` term is so that we can add this as a linearly independent term in our quotient
-            // polynomial
-            T0 = z_perm_fft[i] - fr(1); // T0 = (Z(X) - 1).(\alpha^2)
-            T0 *= alpha_squared;        // T0 = (Z(X) - 1).(\alpha^4)
-            T0 *= l_start[i];           // T0 = (Z(X) - 1).(\alpha^2).L1(X)
-            numerator += T0;
-
-            // Combine into quotient polynomial
-            T0 = numerator - denominator;
-            key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)] =
-                T0 * alpha_base;
-
-            // Update our working root of unity
-            cur_root_times_beta *= key->large_domain.root;
-        }
-    });
-    return alpha_base.sqr().sqr();
+template <size_t program_width, bool idpolys, const size_t num_roots_cut_out_of_vanishing_polynomial>
+void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanishing_polynomial>::
+    end_quotient_contribution()
+{
+    z_perm_fft = polynomial();
+    l_start = polynomial();
+    wire_ffts_ptr = {};
+    sigma_ffts_ptr = {};
+    id_ffts_ptr = {};
 }
 
 // ###
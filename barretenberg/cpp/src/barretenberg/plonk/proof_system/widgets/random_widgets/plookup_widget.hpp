@@ -42,8 +42,36 @@ class ProverPlookupWidget : public ProverRandomWidget {
                                           const size_t round_number,
                                           work_queue& queue) override;
 
-    inline barretenberg::fr compute_quotient_contribution(const barretenberg::fr& alpha_base,
-                                                          const transcript::StandardTranscript& transcript) override;
+    inline barretenberg::fr begin_quotient_contribution(const barretenberg::fr& alpha_base,
+                                                        const transcript::StandardTranscript& transcript) override;
+
+    inline void accumulate_quotient_contribution(size_t start, size_t end) override;
+
+    inline void end_quotient_contribution() override;
+
+  private:
+    // Inputs of the quotient contribution, loaded by begin_quotient_contribution
+    polynomial z_lookup_fft;
+    polynomial s_fft;
+    polynomial l_1;
+    polynomial column_1_step_size;
+    polynomial column_2_step_size;
+    polynomial column_3_step_size;
+    polynomial lookup_fft;
+    polynomial lookup_index_fft;
+    std::array<std::shared_ptr<fr[]>, 3> wire_ffts_ptr;
+    std::array<std::shared_ptr<fr[]>, 4> table_ffts_ptr;
+    std::array<fr*, 3> wire_ffts;
+    std::array<fr*, 4> table_ffts;
+    fr quotient_alpha_base;
+    fr eta;
+    fr alpha;
+    fr beta;
+    fr gamma;
+    fr gamma_beta_constant;
+    fr beta_constant;
+    fr delta_factor;
+    fr alpha_sqr;
 };
 
 } // namespace proof_system::plonk
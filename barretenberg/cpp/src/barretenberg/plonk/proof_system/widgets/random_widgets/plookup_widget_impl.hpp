@@ -253,67 +253,33 @@ void ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_gra
         }
     });
 
-    // Step 2: Compute the constituent product components of Z_lookup(X).
-    // Let ∏ := Prod_{k<j}. Let f_k, t_k and s_k now represent the k'th component of the polynomials f,t and s
-    // defined above. We compute the following four product polynomials needed to construct the grand product
-    // Z_lookup(X).
-    // 1.   accumulators[0][j] = ∏ (q_lookup*f_k + γ)
-    // 2.   accumulators[1][j] = ∏ (t_k + βt_{k+1} + γ(1 + β))
-    // 3.   accumulators[2][j] = ∏ (1 + β)
-    // 4.   accumulators[3][j] = ∏ (s_k + βs_{k+1} + γ(1 + β))
-    // Note: This is a small multithreading bottleneck, as we have only 4 parallelizable processes.
-    parallel_for(4, [&](size_t i) {
-        fr* coeffs = &accumulators[i][0];
-        for (size_t j = 0; j < key->small_domain.size - 1; ++j) {
-            coeffs[j + 1] *= coeffs[j];
-        }
-    });
-
-    // Step 3: Combine the accumulator product elements to construct Z_lookup(X).
-    //
-    //                      ∏ (1 + β) ⋅ ∏ (q_lookup*f_k + γ) ⋅ ∏ (t_k + βt_{k+1} + γ(1 + β))
-    //  Z_lookup(g^j) = --------------------------------------------------------------------------
-    //                                      ∏ (s_k + βs_{k+1} + γ(1 + β))
-    //
-    // Note: Montgomery batch inversion is used to efficiently compute the coefficients of Z_lookup
-    // rather than peforming n individual inversions. I.e. we first compute the double product P_n:
-    //
-    // P_n := ∏_{j<n} ∏_{k<j} S_k, where S_k = (s_k + βs_{k+1} + γ(1 + β))
+    // Step 2: Multiply the numerator terms of Z_lookup(X) together. Let f_k, t_k and s_k now represent the k'th
+    // component of the polynomials f, t and s defined above. We set
     //
-    // and then compute the inverse on P_n. Then we work back to front to obtain terms of the form
-    // 1/∏_{k<i} S_i that appear in Z_lookup, using the fact that P_i/P_{i+1} = 1/∏_{k<i} S_i. (Note
-    // that once we have 1/P_n, we can compute 1/P_{n-1} as (1/P_n) * ∏_{k<n} S_i, and
-    // so on).
+    //      accumulators[0][k] = (q_lookup*f_k + γ) ⋅ (t_k + βt_{k+1} + γ(1 + β)) ⋅ (1 + β)
     //
-    // Compute Z_lookup using Montgomery batch inversion
-    // Note: This loop sets the values of z_lookup[i] for i = 1,...,(n-1), (Recall accumulators[0][i] = z_lookup[i +
-    // 1])
+    // while accumulators[3][k] = (s_k + βs_{k+1} + γ(1 + β)) is the k'th denominator term.
     parallel_for(key->small_domain.num_threads, [&](size_t j) {
         const size_t start = j * key->small_domain.thread_size;
-        // Set 'end' so its max value is (n-1) thus max value for 'i' is n-2 (N.B. accumulators[0][n-2] =
-        // z_lookup[n-1])
-        const size_t end = (j == key->small_domain.num_threads - 1) ? (j + 1) * key->small_domain.thread_size - 1
-                                                                    : (j + 1) * key->small_domain.thread_size;
-
-        // Compute <Z_lookup numerator> * ∏_{j<i}∏_{k<j}S_k
-        fr inversion_accumulator = fr::one();
+        const size_t end = (j + 1) * key->small_domain.thread_size;
         for (size_t i = start; i < end; ++i) {
-            accumulators[0][i] *= accumulators[2][i];
             accumulators[0][i] *= accumulators[1][i];
-            accumulators[0][i] *= inversion_accumulator;
-            inversion_accumulator *= accumulators[3][i];
-        }
-        inversion_accumulator = inversion_accumulator.invert(); // invert
-        // Compute [Z_lookup numerator] * ∏_{j<i}∏_{k<j}S_k / ∏_{j<i+1}∏_{k<j}S_k = <Z_lookup numerator> /
-        // ∏_{k<i}S_k
-        for (size_t i = end - 1; i != start - 1; --i) {
-
-            // N.B. accumulators[0][i] = z_lookup[i + 1]
-            // We can avoid fully reducing z_lookup[i + 1] as the inverse fft will take care of that for us
-            accumulators[0][i] *= inversion_accumulator;
-            inversion_accumulator *= accumulators[3][i];
+            accumulators[0][i] *= accumulators[2][i];
         }
     });
+
+    // Step 3: Combine the numerator and denominator terms to construct Z_lookup(X).
+    //
+    //                      ∏ (1 + β) ⋅ ∏ (q_lookup*f_k + γ) ⋅ ∏ (t_k + βt_{k+1} + γ(1 + β))
+    //  Z_lookup(g^j) = --------------------------------------------------------------------------
+    //                                      ∏ (s_k + βs_{k+1} + γ(1 + β))
+    //
+    // where ∏ := Prod_{k<j}. The running products and the division are fused into one parallel scan, which uses
+    // Montgomery's trick for batch inversion with a single inversion per thread.
+    // Note: This sets the values of z_lookup[i] for i = 1,...,(n-1), (Recall accumulators[0][i] = z_lookup[i + 1]).
+    // We can avoid fully reducing z_lookup[i + 1] as the inverse fft will take care of that for us
+    barretenberg::polynomial_arithmetic::compute_prefix_quotients(std::span<fr>{ accumulators[0], n - 1 },
+                                                                  std::span<const fr>{ accumulators[3], n - 1 });
     z_lookup[0] = fr::one();
 
     // Since `z_plookup` needs to be evaluated at 2 points in UltraPLONK, we need to add a degree-2 random
@@ -417,149 +383,166 @@ void ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_rou
  *
  */
 template <const size_t num_roots_cut_out_of_vanishing_polynomial>
-barretenberg::fr ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::compute_quotient_contribution(
+barretenberg::fr ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::begin_quotient_contribution(
     const fr& alpha_base, const transcript::StandardTranscript& transcript)
 {
-    auto z_lookup_fft = key->polynomial_store.get("z_lookup_fft");
+    z_lookup_fft = key->polynomial_store.get("z_lookup_fft");
 
-    fr eta = fr::serialize_from_buffer(transcript.get_challenge("eta").begin());
-    fr alpha = fr::serialize_from_buffer(transcript.get_challenge("alpha").begin());
-    fr beta = fr::serialize_from_buffer(transcript.get_challenge("beta").begin());
-    fr gamma = fr::serialize_from_buffer(transcript.get_challenge("beta", 1).begin());
+    quotient_alpha_base = alpha_base;
+    eta = fr::serialize_from_buffer(transcript.get_challenge("eta").begin());
+    alpha = fr::serialize_from_buffer(transcript.get_challenge("alpha").begin());
+    beta = fr::serialize_from_buffer(transcript.get_challenge("beta").begin());
+    gamma = fr::serialize_from_buffer(transcript.get_challenge("beta", 1).begin());
 
-    std::array<std::shared_ptr<fr[]>, 3> wire_ffts_ptr{
+    wire_ffts_ptr = {
         key->polynomial_store.get("w_1_fft").data(),
         key->polynomial_store.get("w_2_fft").data(),
         key->polynomial_store.get("w_3_fft").data(),
     };
-    auto wire_ffts = map(wire_ffts_ptr, [](auto& e) { return e.get(); });
+    wire_ffts = map(wire_ffts_ptr, [](auto& e) { return e.get(); });
 
-    auto s_fft = key->polynomial_store.get("s_fft");
+    s_fft = key->polynomial_store.get("s_fft");
 
-    std::array<std::shared_ptr<fr[]>, 4> table_ffts_ptr{
+    table_ffts_ptr = {
         key->polynomial_store.get("table_value_1_fft").data(),
         key->polynomial_store.get("table_value_2_fft").data(),
         key->polynomial_store.get("table_value_3_fft").data(),
         key->polynomial_store.get("table_value_4_fft").data(),
     };
-    auto table_ffts = map(table_ffts_ptr, [](auto& e) { return e.get(); });
+    table_ffts = map(table_ffts_ptr, [](auto& e) { return e.get(); });
 
-    auto column_1_step_size = key->polynomial_store.get("q_2_fft");
-    auto column_2_step_size = key->polynomial_store.get("q_m_fft");
-    auto column_3_step_size = key->polynomial_store.get("q_c_fft");
+    column_1_step_size = key->polynomial_store.get("q_2_fft");
+    column_2_step_size = key->polynomial_store.get("q_m_fft");
+    column_3_step_size = key->polynomial_store.get("q_c_fft");
 
-    auto lookup_fft = key->polynomial_store.get("table_type_fft");
-    auto lookup_index_fft = key->polynomial_store.get("q_3_fft");
+    lookup_fft = key->polynomial_store.get("table_type_fft");
+    lookup_index_fft = key->polynomial_store.get("q_3_fft");
 
-    const fr gamma_beta_constant = gamma * (fr(1) + beta); // γ(1 + β)
+    gamma_beta_constant = gamma * (fr(1) + beta); // γ(1 + β)
 
     // FIXME something weird happens here when this is run with wasm. The first access gives you a wrong hash
     // of lagrange_1_fft. The second and third are the correct hashes of lagrange_1_fft.
     // Since the second value ("l_1") is used in the algorithm, the test passes.
     // However, if you comment out the following line, suddenly "l_1" becomes the "1st" access
     // which is incorrect, and hence the proof fails for wasm.
-    auto l_1 = key->polynomial_store.get("lagrange_1_fft");
+    l_1 = key->polynomial_store.get("lagrange_1_fft");
     // delta_factor = [γ(1 + β)]^{n-k}
-    const fr delta_factor = gamma_beta_constant.pow(key->small_domain.size - num_roots_cut_out_of_vanishing_polynomial);
-    const fr alpha_sqr = alpha.sqr();
+    delta_factor = gamma_beta_constant.pow(key->small_domain.size - num_roots_cut_out_of_vanishing_polynomial);
+    alpha_sqr = alpha.sqr();
+
+    beta_constant = beta + fr(1); // (1 + β)
 
-    const fr beta_constant = beta + fr(1); // (1 + β)
+    return alpha_base * alpha.sqr() * alpha;
+}
 
+template <const size_t num_roots_cut_out_of_vanishing_polynomial>
+void ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::accumulate_quotient_contribution(
+    const size_t start, const size_t end)
+{
     const size_t block_mask = key->large_domain.size - 1;
 
     // Add to the quotient polynomial the components associated with z_lookup
-    parallel_for(key->large_domain.num_threads, [&](size_t j) {
-        const size_t start = j * key->large_domain.thread_size;
-        const size_t end = (j + 1) * key->large_domain.thread_size;
-
-        fr T0;
-        fr T1;
-        fr denominator;
-        fr numerator;
-
-        // Initialize first four t(X) = t_table(X) for expression t + βt(Xω) + γ(1 + β)
-        std::array<fr, 4> next_ts;
-        for (size_t i = 0; i < 4; ++i) {
-            next_ts[i] = table_ffts[3][(start + i) & block_mask];
-            next_ts[i] *= eta;
-            next_ts[i] += table_ffts[2][(start + i) & block_mask];
-            next_ts[i] *= eta;
-            next_ts[i] += table_ffts[1][(start + i) & block_mask];
-            next_ts[i] *= eta;
-            next_ts[i] += table_ffts[0][(start + i) & block_mask];
-        }
-        for (size_t i = start; i < end; ++i) {
-            // Set T0 = f := (w_1 + q_2*w_1(Xω)) + η(w_2 + q_m*w_2(Xω)) + η²(w_3 + q_c*w_3(Xω)) + η³q_index
-            T0 = lookup_index_fft[i];
-            T0 *= eta;
-            T0 += wire_ffts[2][(i + 4) & block_mask] * column_3_step_size[i];
-            T0 += wire_ffts[2][i];
-            T0 *= eta;
-            T0 += wire_ffts[1][(i + 4) & block_mask] * column_2_step_size[i];
-            T0 += wire_ffts[1][i];
-            T0 *= eta;
-            T0 += wire_ffts[0][(i + 4) & block_mask] * column_1_step_size[i];
-            T0 += wire_ffts[0][i];
-
-            // Set numerator = q_lookup*f + γ
-            numerator = T0;
-            numerator *= lookup_fft[i];
-            numerator += gamma;
+    fr T0;
+    fr T1;
+    fr denominator;
+    fr numerator;
+
+    // Initialize first four t(X) = t_table(X) for expression t + βt(Xω) + γ(1 + β)
+    std::array<fr, 4> next_ts;
+    for (size_t i = 0; i < 4; ++i) {
+        next_ts[i] = table_ffts[3][(start + i) & block_mask];
+        next_ts[i] *= eta;
+        next_ts[i] += table_ffts[2][(start + i) & block_mask];
+        next_ts[i] *= eta;
+        next_ts[i] += table_ffts[1][(start + i) & block_mask];
+        next_ts[i] *= eta;
+        next_ts[i] += table_ffts[0][(start + i) & block_mask];
+    }
+    for (size_t i = start; i < end; ++i) {
+        // Set T0 = f := (w_1 + q_2*w_1(Xω)) + η(w_2 + q_m*w_2(Xω)) + η²(w_3 + q_c*w_3(Xω)) + η³q_index
+        T0 = lookup_index_fft[i];
+        T0 *= eta;
+        T0 += wire_ffts[2][(i + 4) & block_mask] * column_3_step_size[i];
+        T0 += wire_ffts[2][i];
+        T0 *= eta;
+        T0 += wire_ffts[1][(i + 4) & block_mask] * column_2_step_size[i];
+        T0 += wire_ffts[1][i];
+        T0 *= eta;
+        T0 += wire_ffts[0][(i + 4) & block_mask] * column_1_step_size[i];
+        T0 += wire_ffts[0][i];
+
+        // Set numerator = q_lookup*f + γ
+        numerator = T0;
+        numerator *= lookup_fft[i];
+        numerator += gamma;
+
+        // Set T0 = t(Xω) := t_1(Xω) + ηt_2(Xω) + η²t_3(Xω) + η³t_4(Xω)
+        T0 = table_ffts[3][(i + 4) & block_mask];
+        T0 *= eta;
+        T0 += table_ffts[2][(i + 4) & block_mask];
+        T0 *= eta;
+        T0 += table_ffts[1][(i + 4) & block_mask];
+        T0 *= eta;
+        T0 += table_ffts[0][(i + 4) & block_mask];
+
+        // Set T1 = (t + βt(Xω) + γ(1 + β))
+        T1 = beta;
+        T1 *= T0;
+        T1 += next_ts[i & 0x03UL];
+        T1 += gamma_beta_constant;
+
+        // Set t(X) = t(Xω) for the next time around
+        next_ts[i & 0x03UL] = T0;
+
+        // numerator = (q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)
+        numerator *= T1;
+        numerator *= beta_constant;
+
+        // Set denominator = (s + βs(Xω) + γ(1 + β))
+        denominator = s_fft[(i + 4) & block_mask];
+        denominator *= beta;
+        denominator += s_fft[i];
+        denominator += gamma_beta_constant;
+
+        // Set T0 = αL_1(X)
+        T0 = l_1[i] * alpha;
+        // Set T1 = α²L_{n-k}(X) = α²L_1(Xω^{-(n-k)+1}) = α²L_1(Xω^{k+1}), k = num roots cut out of Z_H
+        T1 = l_1[(i + 4 + 4 * num_roots_cut_out_of_vanishing_polynomial) & block_mask] * alpha_sqr;
+
+        // Set numerator = z_lookup(X)*[(q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)] + (z_lookup -
+        // 1)*αL_1(X)
+        numerator += T0;
+        numerator *= z_lookup_fft[i];
+        numerator -= T0;
+
+        // Set denominator = z_lookup(Xω)*(s + βs(Xω) + γ(1 + β)) - [z_lookup(Xω) - [γ(1 + β)]^{n-k}]*α²L_{n-k}(X)
+        denominator -= T1;
+        denominator *= z_lookup_fft[(i + 4) & block_mask];
+        denominator += T1 * delta_factor;
+
+        // Combine into quotient polynomial contribution
+        // T0 = z_lookup(X)*[(q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)] + (z_lookup - 1)*αL_1(X) ...
+        //      - z_lookup(Xω)*(s + βs(Xω) + γ(1 + β)) + [z_lookup(Xω) - [γ(1 + β)]^{n-k}]*α²L_{n-k}(X)
+        T0 = numerator - denominator;
+        // key->quotient_large[i] += T0 * alpha_base; // CODY: Luke did this while documenting
+        key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)] +=
+            T0 * quotient_alpha_base;
+    }
+}
 
-            // Set T0 = t(Xω) := t_1(Xω) + ηt_2(Xω) + η²t_3(Xω) + η³t_4(Xω)
-            T0 = table_ffts[3][(i + 4) & block_mask];
-            T0 *= eta;
-            T0 += table_ffts[2][(i + 4) & block_mask];
-            T0 *= eta;
-            T0 += table_ffts[1][(i + 4) & block_mask];
-            T0 *= eta;
-            T0 += table_ffts[0][(i + 4) & block_mask];
-
-            // Set T1 = (t + βt(Xω) + γ(1 + β))
-            T1 = beta;
-            T1 *= T0;
-            T1 += next_ts[i & 0x03UL];
-            T1 += gamma_beta_constant;
-
-            // Set t(X) = t(Xω) for the next time around
-            next_ts[i & 0x03UL] = T0;
-
-            // numerator = (q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)
-            numerator *= T1;
-            numerator *= beta_constant;
-
-            // Set denominator = (s + βs(Xω) + γ(1 + β))
-            denominator = s_fft[(i + 4) & block_mask];
-            denominator *= beta;
-            denominator += s_fft[i];
-            denominator += gamma_beta_constant;
-
-            // Set T0 = αL_1(X)
-            T0 = l_1[i] * alpha;
-            // Set T1 = α²L_{n-k}(X) = α²L_1(Xω^{-(n-k)+1}) = α²L_1(Xω^{k+1}), k = num roots cut out of Z_H
-            T1 = l_1[(i + 4 + 4 * num_roots_cut_out_of_vanishing_polynomial) & block_mask] * alpha_sqr;
-
-            // Set numerator = z_lookup(X)*[(q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)] + (z_lookup -
-            // 1)*αL_1(X)
-            numerator += T0;
-            numerator *= z_lookup_fft[i];
-            numerator -= T0;
-
-            // Set denominator = z_lookup(Xω)*(s + βs(Xω) + γ(1 + β)) - [z_lookup(Xω) - [γ(1 + β)]^{n-k}]*α²L_{n-k}(X)
-            denominator -= T1;
-            denominator *= z_lookup_fft[(i + 4) & block_mask];
-            denominator += T1 * delta_factor;
-
-            // Combine into quotient polynomial contribution
-            // T0 = z_lookup(X)*[(q_lookup*f + γ) * (t + βt(Xω) + γ(1 + β)) * (1 + β)] + (z_lookup - 1)*αL_1(X) ...
-            //      - z_lookup(Xω)*(s + βs(Xω) + γ(1 + β)) + [z_lookup(Xω) - [γ(1 + β)]^{n-k}]*α²L_{n-k}(X)
-            T0 = numerator - denominator;
-            // key->quotient_large[i] += T0 * alpha_base; // CODY: Luke did this while documenting
-            key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)] +=
-                T0 * alpha_base;
-        }
-    });
-    return alpha_base * alpha.sqr() * alpha;
+template <const size_t num_roots_cut_out_of_vanishing_polynomial>
+void ProverPlookupWidget<num_roots_cut_out_of_vanishing_polynomial>::end_quotient_contribution()
+{
+    z_lookup_fft = polynomial();
+    s_fft = polynomial();
+    l_1 = polynomial();
+    column_1_step_size = polynomial();
+    column_2_step_size = polynomial();
+    column_3_step_size = polynomial();
+    lookup_fft = polynomial();
+    lookup_index_fft = polynomial();
+    wire_ffts_ptr = {};
+    table_ffts_ptr = {};
 }
 
 // ###
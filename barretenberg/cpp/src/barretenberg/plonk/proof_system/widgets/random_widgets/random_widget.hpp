@@ -47,8 +47,28 @@ class ProverRandomWidget {
 
     virtual void compute_round_commitments(transcript::StandardTranscript&, const size_t, work_queue&){};
 
-    virtual barretenberg::fr compute_quotient_contribution(const barretenberg::fr& alpha_base,
-                                                           const transcript::StandardTranscript& transcript) = 0;
+    /**
+     * @brief Load the polynomials and challenges needed for the widget's quotient contribution
+     *
+     * @details The quotient contribution is split into begin/accumulate/end so that the prover can evaluate the
+     * identities of every widget on one tile of the large domain before moving on to the next tile.
+     *
+     * @return The power of α to be used by the next widget
+     */
+    virtual barretenberg::fr begin_quotient_contribution(const barretenberg::fr& alpha_base,
+                                                         const transcript::StandardTranscript& transcript) = 0;
+
+    /**
+     * @brief Add the widget's contribution to the quotient polynomial parts over [start, end) of the large domain
+     * @details Called concurrently on disjoint ranges whose bounds are multiples of 4, between
+     * begin_quotient_contribution and end_quotient_contribution.
+     */
+    virtual void accumulate_quotient_contribution(size_t start, size_t end) = 0;
+
+    /**
+     * @brief Release the polynomials loaded by begin_quotient_contribution
+     */
+    virtual void end_quotient_contribution() = 0;
 
     proving_key* key;
 };
@@ -3,12 +3,10 @@
 #include <array>
 #include <cstddef>
 #include <set>
-#include <unordered_map>
 #include <vector>
 
 #include "../../types/prover_settings.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
-#include "barretenberg/polynomials/iterate_over_domain.hpp"
 #include "barretenberg/proof_system/work_queue/work_queue.hpp"
 
 using namespace proof_system;
@@ -43,7 +41,8 @@ template <class Field, size_t num_widget_relations> struct challenge_array {
 template <class Field> using poly_array = std::array<std::pair<Field, Field>, PolynomialIndex::MAX_NUM_POLYNOMIALS>;
 
 template <class Field> struct poly_ptr_map {
-    std::unordered_map<PolynomialIndex, polynomial::pointer> coefficients;
+    // Indexed directly by PolynomialIndex, so that the per-row lookups of the quotient kernels are plain loads
+    std::array<polynomial::pointer, PolynomialIndex::MAX_NUM_POLYNOMIALS> coefficients;
     size_t block_mask;
     size_t index_shift;
 };
@@ -272,7 +271,27 @@ template <class Field> class TransitionWidgetBase {
     };
     virtual ~TransitionWidgetBase() {}
 
-    virtual Field compute_quotient_contribution(const Field&, const transcript::StandardTranscript&) = 0;
+    /**
+     * @brief Load the polynomials and challenges needed for the widget's quotient contribution
+     *
+     * @details The quotient contribution is split into begin/accumulate/end so that the prover can evaluate the
+     * identities of every widget on one tile of the large domain before moving on to the next tile.
+     *
+     * @return The power of α to be used by the next widget
+     */
+    virtual Field begin_quotient_contribution(const Field&, const transcript::StandardTranscript&) = 0;
+
+    /**
+     * @brief Add the widget's contribution to the quotient polynomial parts over [start, end) of the large domain
+     * @details Called concurrently on disjoint ranges, between begin_quotient_contribution and
+     * end_quotient_contribution.
+     */
+    virtual void accumulate_quotient_contribution(size_t start, size_t end) = 0;
+
+    /**
+     * @brief Release the polynomials loaded by begin_quotient_contribution
+     */
+    virtual void end_quotient_contribution() = 0;
 
   public:
     proving_key* key;
@@ -312,8 +331,8 @@ class TransitionWidget : public TransitionWidgetBase<Field> {
         return *this;
     };
 
-    Field compute_quotient_contribution(const Field& alpha_base,
-                                        const transcript::StandardTranscript& transcript) override
+    Field begin_quotient_contribution(const Field& alpha_base,
+                                      const transcript::StandardTranscript& transcript) override
     {
         auto* key = TransitionWidgetBase<Field>::key;
 
@@ -321,25 +340,35 @@ class TransitionWidget : public TransitionWidgetBase<Field> {
         auto& required_polynomial_ids = FFTKernel::get_required_polynomial_ids();
 
         // Construct the map of pointers to the required polynomials
-        poly_ptr_map polynomials = FFTGetter::get_polynomials(key, required_polynomial_ids);
+        polynomials = FFTGetter::get_polynomials(key, required_polynomial_ids);
 
-        challenge_array challenges =
-            FFTGetter::get_challenges(transcript, alpha_base, FFTKernel::quotient_required_challenges);
+        challenges = FFTGetter::get_challenges(transcript, alpha_base, FFTKernel::quotient_required_challenges);
 
-        ITERATE_OVER_DOMAIN_START(key->large_domain);
-        coefficient_array linear_terms;
-        FFTKernel::compute_linear_terms(polynomials, challenges, linear_terms, i);
-        Field sum_of_linear_terms = FFTKernel::sum_linear_terms(polynomials, challenges, linear_terms, i);
+        return FFTGetter::update_alpha(challenges, FFTKernel::num_independent_relations);
+    }
+
+    void accumulate_quotient_contribution(const size_t start, const size_t end) override
+    {
+        auto* key = TransitionWidgetBase<Field>::key;
 
-        // populate split quotient components
-        Field& quotient_term =
-            key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)];
-        quotient_term += sum_of_linear_terms;
-        FFTKernel::compute_non_linear_terms(polynomials, challenges, quotient_term, i);
-        ITERATE_OVER_DOMAIN_END;
+        for (size_t i = start; i < end; ++i) {
+            coefficient_array linear_terms;
+            FFTKernel::compute_linear_terms(polynomials, challenges, linear_terms, i);
+            Field sum_of_linear_terms = FFTKernel::sum_linear_terms(polynomials, challenges, linear_terms, i);
 
-        return FFTGetter::update_alpha(challenges, FFTKernel::num_independent_relations);
+            // populate split quotient components
+            Field& quotient_term =
+                key->quotient_polynomial_parts[i >> key->small_domain.log2_size][i & (key->circuit_size - 1)];
+            quotient_term += sum_of_linear_terms;
+            FFTKernel::compute_non_linear_terms(polynomials, challenges, quotient_term, i);
+        }
     }
+
+    void end_quotient_contribution() override { polynomials = poly_ptr_map(); }
+
+  private:
+    poly_ptr_map polynomials;
+    challenge_array challenges;
 };
 
 template <class Field, class Transcript, class Settings, template <typename, typename, typename> typename KernelBase>
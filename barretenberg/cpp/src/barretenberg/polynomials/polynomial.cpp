@@ -309,16 +309,8 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(std::span<const Fr> other
     const size_t other_size = other.size();
     ASSERT(in_place_operation_viable(other_size));
 
-    // Calculates number of threads with thread_utils::calculate_num_threads
-    size_t num_threads = thread_utils::calculate_num_threads(other_size);
-    size_t range_per_thread = other_size / num_threads;
-    size_t leftovers = other_size - (range_per_thread * num_threads);
-    parallel_for(num_threads, [&](size_t j) {
-        size_t offset = j * range_per_thread;
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_.get()[i] += scaling_factor * other[i];
-        }
+    parallel_for_range(0, other_size, thread_utils::DEFAULT_MIN_ITERS_PER_THREAD, [&](size_t i) {
+        coefficients_.get()[i] += scaling_factor * other[i];
     });
 }
 
@@ -327,15 +319,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(std::span<cons
     const size_t other_size = other.size();
     ASSERT(in_place_operation_viable(other_size));
 
-    size_t num_threads = thread_utils::calculate_num_threads(other_size);
-    size_t range_per_thread = other_size / num_threads;
-    size_t leftovers = other_size - (range_per_thread * num_threads);
-    parallel_for(num_threads, [&](size_t j) {
-        size_t offset = j * range_per_thread;
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_.get()[i] += other[i];
-        }
+    parallel_for_range(0, other_size, thread_utils::DEFAULT_MIN_ITERS_PER_THREAD, [&](size_t i) {
+        coefficients_.get()[i] += other[i];
     });
 
     return *this;
@@ -346,15 +331,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(std::span<cons
     const size_t other_size = other.size();
     ASSERT(in_place_operation_viable(other_size));
 
-    size_t num_threads = thread_utils::calculate_num_threads(other_size);
-    size_t range_per_thread = other_size / num_threads;
-    size_t leftovers = other_size - (range_per_thread * num_threads);
-    parallel_for(num_threads, [&](size_t j) {
-        size_t offset = j * range_per_thread;
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_.get()[i] -= other[i];
-        }
+    parallel_for_range(0, other_size, thread_utils::DEFAULT_MIN_ITERS_PER_THREAD, [&](size_t i) {
+        coefficients_.get()[i] -= other[i];
     });
 
     return *this;
@@ -364,15 +342,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
 {
     ASSERT(in_place_operation_viable());
 
-    size_t num_threads = thread_utils::calculate_num_threads(size_);
-    size_t range_per_thread = size_ / num_threads;
-    size_t leftovers = size_ - (range_per_thread * num_threads);
-    parallel_for(num_threads, [&](size_t j) {
-        size_t offset = j * range_per_thread;
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            coefficients_.get()[i] *= scaling_factor;
-        }
+    parallel_for_range(0, size_, thread_utils::DEFAULT_MIN_ITERS_PER_THREAD, [&](size_t i) {
+        coefficients_.get()[i] *= scaling_factor;
     });
 
     return *this;
@@ -5,6 +5,7 @@
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "iterate_over_domain.hpp"
+#include <algorithm>
 #include <math.h>
 #include <memory.h>
 #include <memory>
@@ -13,6 +14,25 @@ namespace barretenberg::polynomial_arithmetic {
 
 namespace {
 
+// Each chunk of a parallel evaluation starts with a `pow` of the evaluation point, so keep chunks large enough to
+// amortise it.
+constexpr size_t MIN_EVALUATE_ITERATIONS_PER_THREAD = 1 << 10;
+
+// Each chunk of `compute_prefix_quotients` is swept three times and pays for an inversion
+constexpr size_t MIN_PREFIX_PRODUCT_ITERATIONS_PER_THREAD = 1 << 11;
+
+// FFTs over domains larger than one tile are evaluated cache-blocked (see `fft_inner_blocked_rounds`). A tile of 2^13
+// field elements (for a single polynomial) is 256KiB, which leaves room in a core's L2 for the root table entries the
+// tile rounds read.
+constexpr size_t FFT_LOG2_TILE_SIZE = 13;
+// The rounds past the tile rounds are fused this many at a time, so the array is streamed through memory once per
+// group of rounds instead of once per round
+constexpr size_t FFT_LOG2_RADIX = 4;
+// Consecutive butterfly columns processed together by the fused rounds, so every row we touch fills whole cache lines
+constexpr size_t FFT_COLUMN_BLOCK_SIZE = 64;
+// Keeps the per-round chunks of the small-domain batched FFT large enough to be worth a thread
+constexpr size_t FFT_MIN_BUTTERFLIES_PER_THREAD = 1 << 10;
+
 template <typename Fr> std::shared_ptr<Fr[]> get_scratch_space(const size_t num_elements)
 {
     // WASM needs to release slab so it can be reused elsewhere.
@@ -30,6 +50,30 @@ template <typename Fr> std::shared_ptr<Fr[]> get_scratch_space(const size_t num_
 #endif
 }
 
+/**
+ * @brief Second half of a chunked prefix product: `chunk_products[k]` holds the product of chunk k's entries, and each
+ * chunk's entries are replaced by the running product taken on from the product of all of the chunks before it.
+ *
+ * @details There is one chunk per thread, so scanning the chunk products serially is all the combine step needs.
+ */
+template <typename Fr> void scan_chunks_from_offsets(std::span<Fr> values, std::vector<Fr>& chunk_products)
+{
+    Fr offset = Fr::one();
+    for (auto& chunk_product : chunk_products) {
+        const Fr product = chunk_product;
+        chunk_product = offset;
+        offset *= product;
+    }
+    const size_t num_chunks = chunk_products.size();
+    parallel_for(num_chunks, [&](size_t chunk_index) {
+        auto [start, end] = get_range_chunk(0, values.size(), num_chunks, chunk_index);
+        Fr running_product = chunk_products[chunk_index];
+        for (size_t i = start; i < end; ++i) {
+            running_product *= values[i];
+            values[i] = running_product;
+        }
+    });
+}
 } // namespace
 
 inline uint32_t reverse_bits(uint32_t x, uint32_t bit_length)
@@ -168,6 +212,126 @@ void compute_multiplicative_subgroup(const size_t log2_subgroup_size,
     }
 }
 
+/**
+ * Log2 of the tile size `fft_inner_blocked_rounds` uses when transforming `num_polys` polynomials together: the tiles
+ * of all of them have to share the cache. Never below 2^6, so a tile still spans a whole column block.
+ **/
+inline size_t get_fft_log2_tile_size(const size_t num_polys)
+{
+    const size_t log2_num_polys = num_polys > 1 ? static_cast<size_t>(numeric::get_msb(num_polys - 1)) + 1 : 0;
+    return std::max(FFT_LOG2_TILE_SIZE - std::min(log2_num_polys, FFT_LOG2_TILE_SIZE), size_t(6));
+}
+
+/**
+ * Evaluates the FFT rounds of every polynomial in `polys`, which hold bit-reversed inputs. Unless
+ * `apply_first_round` is set, the first round of butterflies has already been applied. Requires a domain larger than
+ * one tile (see `get_fft_log2_tile_size`).
+ *
+ * The plain round-by-round loop in `fft_inner_parallel` streams the whole array through memory once per round, which
+ * dominates once the domain no longer fits in cache. Instead:
+ *
+ * 1. the rounds whose butterflies stay within an aligned tile are run tile by tile, so each tile is loaded once for
+ *    all of them;
+ * 2. the remaining rounds are fused into passes of up to FFT_LOG2_RADIX rounds. For a pass starting at butterfly
+ *    half-size m, the element at index `base + c + t * m` (t < 2^rounds) only ever meets elements with the same `base`
+ *    and `c`, so each such column of 2^rounds rows is carried through all the pass's rounds while it is in cache.
+ *    Neighbouring columns are processed together (FFT_COLUMN_BLOCK_SIZE at a time) so the row reads are contiguous.
+ *
+ * With several polynomials, each twiddle factor is loaded once and applied to the same butterfly of all of them.
+ * The last round's outputs are handed to `store(poly_index, index, value)` rather than written back to `polys`.
+ **/
+template <typename Fr, typename Store>
+    requires SupportsFFT<Fr>
+void fft_inner_blocked_rounds(std::span<Fr* const> polys,
+                              const size_t domain_size,
+                              const std::vector<Fr*>& root_table,
+                              const bool apply_first_round,
+                              Store&& store)
+{
+    const size_t num_polys = polys.size();
+    const size_t log2_size = static_cast<size_t>(numeric::get_msb(domain_size));
+    const size_t log2_tile_size = get_fft_log2_tile_size(num_polys);
+    ASSERT(log2_size > log2_tile_size);
+    const size_t tile_size = 1UL << log2_tile_size;
+
+    parallel_for_range(0, domain_size / tile_size, 1, [&](size_t tile) {
+        const size_t tile_start = tile * tile_size;
+        Fr temp;
+        if (apply_first_round) {
+            for (Fr* poly : polys) {
+                for (size_t k = tile_start; k < tile_start + tile_size; k += 2) {
+                    temp = poly[k + 1];
+                    poly[k + 1] = poly[k] - temp;
+                    poly[k] += temp;
+                }
+            }
+        }
+        for (size_t m = 2; m < tile_size; m <<= 1) {
+            const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+            for (size_t k = tile_start; k < tile_start + tile_size; k += 2 * m) {
+                for (size_t j = 0; j < m; ++j) {
+                    const Fr& root = round_roots[j];
+                    for (Fr* poly : polys) {
+                        temp = root * poly[k + j + m];
+                        poly[k + j + m] = poly[k + j] - temp;
+                        poly[k + j] += temp;
+                    }
+                }
+            }
+        }
+    });
+
+    // Spread the remaining rounds evenly over the passes, e.g. 9 rounds become passes of 3 rather than 4, 4 and 1
+    const size_t num_fused_rounds = log2_size - log2_tile_size;
+    const size_t num_passes = (num_fused_rounds + FFT_LOG2_RADIX - 1) / FFT_LOG2_RADIX;
+    size_t log2_m = log2_tile_size;
+    for (size_t pass = 0; pass < num_passes; ++pass) {
+        const size_t num_pass_rounds = (log2_size - log2_m + (num_passes - pass) - 1) / (num_passes - pass);
+        const size_t num_rows = 1UL << num_pass_rounds;
+        const size_t m = 1UL << log2_m;
+        const bool is_last_pass = (pass == num_passes - 1);
+        const size_t num_column_blocks = (domain_size >> num_pass_rounds) / FFT_COLUMN_BLOCK_SIZE;
+
+        parallel_for_range(0, num_column_blocks, 1, [&](size_t block) {
+            // columns are numbered `base_index * m + c`, and the first row of a column sits at `base_index * m *
+            // num_rows + c`
+            const size_t column = block * FFT_COLUMN_BLOCK_SIZE;
+            const size_t column_offset = column & (m - 1);
+            const size_t block_start = ((column >> log2_m) << (log2_m + num_pass_rounds)) + column_offset;
+            Fr temp;
+            for (size_t round = 0; round < num_pass_rounds; ++round) {
+                const size_t round_m = m << round;
+                const Fr* round_roots = root_table[log2_m + round - 1];
+                const bool is_last_round = is_last_pass && (round == num_pass_rounds - 1);
+                for (size_t row = 0; row < num_rows; ++row) {
+                    if ((row >> round) & 1) {
+                        continue;
+                    }
+                    // the row's position within its butterfly block of size 2 * round_m selects the root
+                    const Fr* roots = round_roots + ((row & ((1UL << round) - 1)) << log2_m) + column_offset;
+                    const size_t even_start = block_start + (row << log2_m);
+                    const size_t odd_start = even_start + round_m;
+                    for (size_t c = 0; c < FFT_COLUMN_BLOCK_SIZE; ++c) {
+                        const Fr& root = roots[c];
+                        for (size_t p = 0; p < num_polys; ++p) {
+                            Fr* poly = polys[p];
+                            temp = root * poly[odd_start + c];
+                            if (is_last_round) {
+                                store(p, odd_start + c, poly[even_start + c] - temp);
+                                store(p, even_start + c, poly[even_start + c] + temp);
+                            } else {
+                                poly[odd_start + c] = poly[even_start + c] - temp;
+                                poly[even_start + c] += temp;
+                            }
+                        }
+                    }
+                }
+            }
+        });
+        log2_m += num_pass_rounds;
+    }
+}
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void fft_inner_parallel(std::vector<Fr*> coeffs,
@@ -209,6 +373,17 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
         }
     });
 
+    if (domain.log2_size > get_fft_log2_tile_size(1)) {
+        fft_inner_blocked_rounds<Fr>({ &scratch_space, 1 },
+                                     domain.size,
+                                     root_table,
+                                     false,
+                                     [&](size_t, size_t i, const Fr& value) {
+                                         coeffs[i >> log2_poly_size][i & poly_mask] = value;
+                                     });
+        return;
+    }
+
     // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
     // reduce + copy
     if (domain.size <= 2) {
@@ -320,6 +495,14 @@ void fft_inner_parallel(
         }
     });
 
+    if (domain.log2_size > get_fft_log2_tile_size(1)) {
+        fft_inner_blocked_rounds<Fr>(
+            { &target, 1 }, domain.size, root_table, false, [&](size_t, size_t i, const Fr& value) {
+                target[i] = value;
+            });
+        return;
+    }
+
     // hard code exception for when the domain size is tiny - we won't execute the next loop, so need to manually
     // reduce + copy
     if (domain.size <= 2) {
@@ -737,6 +920,91 @@ void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
     }
 }
 
+/**
+ * In-place FFT of every polynomial in `polys` over `domain`. The polynomials are transformed in lockstep, so each
+ * twiddle factor is loaded once per butterfly for all of them instead of once per polynomial.
+ **/
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_fft_inner(const std::vector<Fr*>& polys,
+                     const EvaluationDomain<Fr>& domain,
+                     const std::vector<Fr*>& root_table)
+{
+    if (polys.empty() || domain.size < 2) {
+        return;
+    }
+
+    parallel_for_range(0, domain.size, FFT_MIN_BUTTERFLIES_PER_THREAD, [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            const size_t swap_index = reverse_bits(static_cast<uint32_t>(i), static_cast<uint32_t>(domain.log2_size));
+            if (i < swap_index) {
+                for (Fr* poly : polys) {
+                    Fr::__swap(poly[i], poly[swap_index]);
+                }
+            }
+        }
+    });
+
+    if (domain.log2_size > get_fft_log2_tile_size(polys.size())) {
+        fft_inner_blocked_rounds<Fr>(
+            polys, domain.size, root_table, true, [&](size_t p, size_t i, const Fr& value) { polys[p][i] = value; });
+        return;
+    }
+
+    parallel_for_range(0, domain.size >> 1, FFT_MIN_BUTTERFLIES_PER_THREAD, [&](size_t i) {
+        Fr temp;
+        for (Fr* poly : polys) {
+            temp = poly[2 * i + 1];
+            poly[2 * i + 1] = poly[2 * i] - temp;
+            poly[2 * i] += temp;
+        }
+    });
+    for (size_t m = 2; m < domain.size; m <<= 1) {
+        const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+        parallel_for_range(0, domain.size >> 1, FFT_MIN_BUTTERFLIES_PER_THREAD, [&](size_t i) {
+            // see `fft_inner_parallel` for how the flattened loop index maps onto butterflies
+            const size_t k1 = (i & ~(m - 1)) << 1;
+            const size_t j1 = i & (m - 1);
+            const Fr& root = round_roots[j1];
+            Fr temp;
+            for (Fr* poly : polys) {
+                temp = root * poly[k1 + j1 + m];
+                poly[k1 + j1 + m] = poly[k1 + j1] - temp;
+                poly[k1 + j1] += temp;
+            }
+        });
+    }
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_fft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    batch_fft_inner(polys, domain, domain.get_round_roots());
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_ifft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    batch_fft_inner(polys, domain, domain.get_inverse_round_roots());
+    ITERATE_OVER_DOMAIN_START(domain);
+    for (Fr* poly : polys) {
+        poly[i] *= domain.domain_inverse;
+    }
+    ITERATE_OVER_DOMAIN_END;
+}
+
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_coset_fft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    for (Fr* poly : polys) {
+        scale_by_generator(poly, poly, domain, Fr::one(), domain.generator, domain.generator_size);
+    }
+    batch_fft(polys, domain);
+}
+
 template <typename Fr>
 void add(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationDomain<Fr>& domain)
 {
@@ -763,28 +1031,21 @@ void mul(const Fr* a_coeffs, const Fr* b_coeffs, Fr* r_coeffs, const EvaluationD
 
 template <typename Fr> Fr evaluate(const Fr* coeffs, const Fr& z, const size_t n)
 {
-    size_t num_threads = get_num_cpus_pow2();
-    size_t range_per_thread = n / num_threads;
-    size_t leftovers = n - (range_per_thread * num_threads);
-    Fr* evaluations = new Fr[num_threads];
-    parallel_for(num_threads, [&](size_t j) {
-        Fr z_acc = z.pow(static_cast<uint64_t>(j * range_per_thread));
-        size_t offset = j * range_per_thread;
-        evaluations[j] = Fr::zero();
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            Fr work_var = z_acc * coeffs[i];
-            evaluations[j] += work_var;
-            z_acc *= z;
-        }
-    });
-
-    Fr r = Fr::zero();
-    for (size_t j = 0; j < num_threads; ++j) {
-        r += evaluations[j];
-    }
-    delete[] evaluations;
-    return r;
+    return parallel_reduce(
+        0,
+        n,
+        MIN_EVALUATE_ITERATIONS_PER_THREAD,
+        Fr::zero(),
+        [&](size_t start, size_t end) {
+            Fr z_acc = z.pow(static_cast<uint64_t>(start));
+            Fr evaluation = Fr::zero();
+            for (size_t i = start; i < end; ++i) {
+                evaluation += z_acc * coeffs[i];
+                z_acc *= z;
+            }
+            return evaluation;
+        },
+        [](Fr acc, Fr partial) { return acc + partial; });
 }
 
 template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, const size_t large_n)
@@ -793,28 +1054,21 @@ template <typename Fr> Fr evaluate(const std::vector<Fr*> coeffs, const Fr& z, c
     const size_t poly_size = large_n / num_polys;
     ASSERT(is_power_of_two(poly_size));
     const size_t log2_poly_size = (size_t)numeric::get_msb(poly_size);
-    size_t num_threads = get_num_cpus_pow2();
-    size_t range_per_thread = large_n / num_threads;
-    size_t leftovers = large_n - (range_per_thread * num_threads);
-    Fr* evaluations = new Fr[num_threads];
-    parallel_for(num_threads, [&](size_t j) {
-        Fr z_acc = z.pow(static_cast<uint64_t>(j * range_per_thread));
-        size_t offset = j * range_per_thread;
-        evaluations[j] = Fr::zero();
-        size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            Fr work_var = z_acc * coeffs[i >> log2_poly_size][i & (poly_size - 1)];
-            evaluations[j] += work_var;
-            z_acc *= z;
-        }
-    });
-
-    Fr r = Fr::zero();
-    for (size_t j = 0; j < num_threads; ++j) {
-        r += evaluations[j];
-    }
-    delete[] evaluations;
-    return r;
+    return parallel_reduce(
+        0,
+        large_n,
+        MIN_EVALUATE_ITERATIONS_PER_THREAD,
+        Fr::zero(),
+        [&](size_t start, size_t end) {
+            Fr z_acc = z.pow(static_cast<uint64_t>(start));
+            Fr evaluation = Fr::zero();
+            for (size_t i = start; i < end; ++i) {
+                evaluation += z_acc * coeffs[i >> log2_poly_size][i & (poly_size - 1)];
+                z_acc *= z;
+            }
+            return evaluation;
+        },
+        [](Fr acc, Fr partial) { return acc + partial; });
 }
 
 /**
@@ -1199,6 +1453,37 @@ Fr evaluate_from_fft(const Fr* poly_coset_fft,
     return result;
 }
 
+template <typename Fr> void compute_prefix_quotients(std::span<Fr> numerators, std::span<const Fr> denominators)
+{
+    ASSERT(denominators.size() >= numerators.size());
+    const size_t num_chunks = get_num_range_chunks(0, numerators.size(), MIN_PREFIX_PRODUCT_ITERATIONS_PER_THREAD);
+    if (num_chunks == 0) {
+        return;
+    }
+    // Replace each numerator with its quotient, using one inversion per chunk (Montgomery's trick), and take the
+    // product of the quotients along the way
+    std::vector<Fr> chunk_products(num_chunks);
+    parallel_for(num_chunks, [&](size_t chunk_index) {
+        auto [start, end] = get_range_chunk(0, numerators.size(), num_chunks, chunk_index);
+        // numerators[i] <- numerators[i] * ∏_{start ≤ j < i} denominators[j]
+        Fr denominator_product = Fr::one();
+        for (size_t i = start; i < end; ++i) {
+            numerators[i] *= denominator_product;
+            denominator_product *= denominators[i];
+        }
+        // Walking back down the chunk, `inverse` is (∏_{start ≤ j ≤ i} denominators[j])^{-1}
+        Fr inverse = denominator_product.invert();
+        Fr quotient_product = Fr::one();
+        for (size_t i = end; i-- > start;) {
+            numerators[i] *= inverse;
+            inverse *= denominators[i];
+            quotient_product *= numerators[i];
+        }
+        chunk_products[chunk_index] = quotient_product;
+    });
+    scan_chunks_from_offsets(numerators, chunk_products);
+}
+
 // This function computes sum of all scalars in a given array.
 template <typename Fr> Fr compute_sum(const Fr* src, const size_t n)
 {
@@ -1387,6 +1672,9 @@ template void ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
 template void ifft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void coset_ifft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_ifft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+template void batch_fft<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void batch_ifft<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void batch_coset_fft<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 template void partial_fft_serial_inner<fr>(fr*, fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&);
 template void partial_fft_parellel_inner<fr>(fr*, const EvaluationDomain<fr>&, const std::vector<fr*>&, fr, bool);
 template void partial_fft_serial<fr>(fr*, fr*, const EvaluationDomain<fr>&);
@@ -1404,6 +1692,7 @@ template LagrangeEvaluations<fr> get_lagrange_evaluations<fr>(const fr&, const E
 template fr compute_barycentric_evaluation<fr>(const fr*, const size_t, const fr&, const EvaluationDomain<fr>&);
 template void compress_fft<fr>(const fr*, fr*, const size_t, const size_t);
 template fr evaluate_from_fft<fr>(const fr*, const EvaluationDomain<fr>&, const fr&, const EvaluationDomain<fr>&);
+template void compute_prefix_quotients<fr>(std::span<fr>, std::span<const fr>);
 template fr compute_sum<fr>(const fr*, const size_t);
 template void compute_linear_polynomial_product<fr>(const fr*, fr*, const size_t);
 template fr compute_linear_polynomial_product_evaluation<fr>(const fr*, const fr, const size_t);
@@ -1427,6 +1716,7 @@ template void mul<grumpkin::fr>(const grumpkin::fr*,
                                 const grumpkin::fr*,
                                 grumpkin::fr*,
                                 const EvaluationDomain<grumpkin::fr>&);
+template void compute_prefix_quotients<grumpkin::fr>(std::span<grumpkin::fr>, std::span<const grumpkin::fr>);
 template grumpkin::fr compute_sum<grumpkin::fr>(const grumpkin::fr*, const size_t);
 template void compute_linear_polynomial_product<grumpkin::fr>(const grumpkin::fr*, grumpkin::fr*, const size_t);
 template grumpkin::fr compute_linear_polynomial_product_evaluation<grumpkin::fr>(const grumpkin::fr*,
@@ -96,6 +96,17 @@ template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_ifft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain);
 
+// In-place transforms of several same-sized polynomials at once, sharing each twiddle factor load between them
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_fft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_ifft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_coset_fft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void partial_fft_serial_inner(Fr* coeffs,
@@ -174,6 +185,15 @@ Fr evaluate_from_fft(const Fr* poly_coset_fft,
                      const Fr& z,
                      const EvaluationDomain<Fr>& small_domain);
 
+/**
+ * @brief numerators[i] <- ∏_{j ≤ i} numerators[j] / denominators[j], as needed for a grand product polynomial.
+ *
+ * @details The division is folded into the scan: each thread batch-inverts its chunk of denominators with a single
+ * inversion while forming the quotients, so no separate prefix product or inversion pass is made over the
+ * denominators. The denominators must be nonzero.
+ */
+template <typename Fr> void compute_prefix_quotients(std::span<Fr> numerators, std::span<const Fr> denominators);
+
 // This function computes sum of all scalars in a given array.
 template <typename Fr> Fr compute_sum(const Fr* src, const size_t n);
 
@@ -156,6 +156,97 @@ TEST(polynomials, fft_ifft_consistency)
     }
 }
 
+/**
+ * @brief Domains larger than an FFT tile take the cache-blocked path. 2^18 needs more than one pass of fused rounds.
+ */
+TEST(polynomials, blocked_fft)
+{
+    constexpr size_t log2_n = 18;
+    constexpr size_t n = 1UL << log2_n;
+    constexpr size_t num_poly = 4;
+    // drawing 2^18 random elements is slow, so only the first coefficient is random
+    polynomial poly(n);
+    poly[0] = fr::random_element();
+    for (size_t i = 1; i < n; ++i) {
+        poly[i] = poly[i - 1].sqr() + fr(i);
+    }
+
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+
+    polynomial result(poly);
+    polynomial target(n);
+    std::vector<polynomial> split_result;
+    std::vector<fr*> coeffs_vec;
+    for (size_t j = 0; j < num_poly; j++) {
+        split_result.emplace_back(n / num_poly);
+        for (size_t i = 0; i < n / num_poly; ++i) {
+            split_result[j][i] = poly[j * (n / num_poly) + i];
+        }
+        coeffs_vec.push_back(split_result[j].data().get());
+    }
+    polynomial_arithmetic::fft(result.data().get(), domain);
+    polynomial_arithmetic::fft(poly.data().get(), target.data().get(), domain);
+    polynomial_arithmetic::fft(coeffs_vec, domain);
+
+    for (size_t i = 0; i < n; i += 32771) {
+        const fr expected = polynomial_arithmetic::evaluate(poly.data().get(), domain.root.pow(i), n);
+        EXPECT_EQ(result[i], expected);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(target[i], result[i]);
+        EXPECT_EQ(split_result[i / (n / num_poly)][i % (n / num_poly)], result[i]);
+    }
+
+    polynomial_arithmetic::coset_fft(result.data().get(), domain);
+    polynomial_arithmetic::coset_ifft(result.data().get(), domain);
+    polynomial_arithmetic::ifft(result.data().get(), domain);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(result[i], poly[i]);
+    }
+}
+
+TEST(polynomials, batch_fft_matches_fft)
+{
+    constexpr size_t num_polys = 3;
+    // 2^16 takes the cache-blocked path with more than one pass of fused rounds
+    for (const size_t n : { size_t(256), size_t(1) << 16 }) {
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+
+        std::vector<polynomial> polys;
+        std::vector<polynomial> expected;
+        std::vector<fr*> poly_data;
+        for (size_t j = 0; j < num_polys; ++j) {
+            polynomial& poly = polys.emplace_back(n);
+            poly[0] = fr::random_element();
+            for (size_t i = 1; i < n; ++i) {
+                poly[i] = poly[i - 1].sqr() + fr(i);
+            }
+            expected.emplace_back(poly);
+            poly_data.push_back(poly.data().get());
+        }
+
+        polynomial_arithmetic::batch_fft(poly_data, domain);
+        for (size_t j = 0; j < num_polys; ++j) {
+            expected[j].fft(domain);
+            EXPECT_EQ(polys[j], expected[j]);
+        }
+
+        polynomial_arithmetic::batch_ifft(poly_data, domain);
+        for (size_t j = 0; j < num_polys; ++j) {
+            expected[j].ifft(domain);
+            EXPECT_EQ(polys[j], expected[j]);
+        }
+
+        polynomial_arithmetic::batch_coset_fft(poly_data, domain);
+        for (size_t j = 0; j < num_polys; ++j) {
+            expected[j].coset_fft(domain);
+            EXPECT_EQ(polys[j], expected[j]);
+        }
+    }
+}
+
 TEST(polynomials, split_polynomial_fft_ifft_consistency)
 {
     constexpr size_t n = 256;
@@ -1000,6 +1091,31 @@ TYPED_TEST(PolynomialTests, compute_efficient_interpolation)
     }
 }
 
+TYPED_TEST(PolynomialTests, prefix_quotients)
+{
+    using FF = TypeParam;
+    // Sizes below and above the per-thread minimum, and one that does not split evenly into chunks
+    for (size_t n : { 0UL, 1UL, 7UL, 50001UL }) {
+        std::vector<FF> numerators(n);
+        std::vector<FF> denominators(n);
+        for (size_t i = 0; i < n; ++i) {
+            numerators[i] = FF(i + 2);
+            denominators[i] = FF(3 * i + 5);
+        }
+        std::vector<FF> quotients = numerators;
+        polynomial_arithmetic::compute_prefix_quotients(std::span<FF>{ quotients },
+                                                        std::span<const FF>{ denominators });
+
+        FF expected_numerator = 1;
+        FF expected_denominator = 1;
+        for (size_t i = 0; i < n; ++i) {
+            expected_numerator *= numerators[i];
+            expected_denominator *= denominators[i];
+            EXPECT_EQ(quotients[i] * expected_denominator, expected_numerator);
+        }
+    }
+}
+
 TYPED_TEST(PolynomialTests, interpolation_constructor_single)
 {
     using FF = TypeParam;
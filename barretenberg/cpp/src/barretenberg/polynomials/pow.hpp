@@ -1,4 +1,6 @@
 #pragma once
+#include "barretenberg/common/thread.hpp"
+#include <vector>
 
 namespace barretenberg {
 
@@ -102,6 +104,11 @@ template <typename FF> struct PowUnivariate {
     // c_{l} = ∏_{0 ≤ k < l-1} ( (1-u_{k}) + u_{k}⋅ζ_{k} )
     // At round d-1, equals pow(u_{0}, ..., u_{d-1}).
     FF partial_evaluation_constant = FF(1);
+    // ζ_{1}ⁱ for 0 ≤ i < 2^{d-1}, built once by the prover with `compute_pow_table`. At round l, edge i needs
+    // ζ_{l+1}ⁱ = ζ_{1}^{i⋅2^l}, i.e. every 2^l-th entry, so partially evaluating folds the table by doubling
+    // `pow_table_stride` rather than by rewriting it.
+    std::vector<FF> pow_table;
+    size_t pow_table_stride = 1;
 
     // Initialize with the random zeta
     explicit PowUnivariate(FF zeta_pow)
@@ -112,6 +119,31 @@ template <typename FF> struct PowUnivariate {
     // Evaluate the monomial ((1−X_{l}) + X_{l}⋅ζ_{l}) in the challenge point X_{l}=u_{l}.
     FF univariate_eval(FF challenge) const { return (FF(1) + (challenge * (zeta_pow - FF(1)))); };
 
+    /**
+     * @brief Fill `pow_table` with the powers ζ_{l+1}ⁱ needed by the `num_edges` edges of the current round l.
+     *
+     * @details Each thread raises ζ_{l+1} to the start of its chunk and takes a running product from there.
+     */
+    void compute_pow_table(size_t num_edges)
+    {
+        pow_table.resize(num_edges);
+        pow_table_stride = 1;
+        constexpr size_t min_powers_per_thread = 1 << 10;
+        parallel_for_range(0, num_edges, min_powers_per_thread, [&](size_t start, size_t end) {
+            FF power = zeta_pow_sqr.pow(start);
+            for (size_t i = start; i < end; ++i) {
+                pow_table[i] = power;
+                power *= zeta_pow_sqr;
+            }
+        });
+    }
+
+    // c_l ⋅ ζ_{l+1}ⁱ, the pow polynomial's contribution to edge i of the current round. Requires `compute_pow_table`
+    FF get_pow_challenge(size_t edge_idx) const
+    {
+        return partial_evaluation_constant * pow_table[edge_idx * pow_table_stride];
+    }
+
     /**
      * @brief Parially evaluate the polynomial in the new challenge, by updating the constant c_{l} -> c_{l+1}.
      * Also update (ζ_{l}, ζ_{l+1}) -> (ζ_{l+1}, ζ_{l+1}^2)
@@ -126,6 +158,7 @@ template <typename FF> struct PowUnivariate {
         zeta_pow_sqr = zeta_pow_sqr.sqr();
 
         partial_evaluation_constant *= current_univariate_eval;
+        pow_table_stride <<= 1;
     }
 };
 } // namespace barretenberg
\ No newline at end of file
@@ -28,4 +28,24 @@ TEST(SumcheckPow, FullPowConsistency)
 
     EXPECT_EQ(pow_univariate.partial_evaluation_constant, expected_eval);
 }
+
+TEST(SumcheckPow, PowTableMatchesRunningProduct)
+{
+    constexpr size_t d = 12;
+    constexpr size_t n = 1 << d;
+
+    FF zeta = FF::random_element();
+    PowUnivariate<FF> pow_univariate(zeta);
+    pow_univariate.compute_pow_table(n >> 1);
+
+    // In each round, edge i gets c_l ⋅ ζ_{l+1}ⁱ
+    for (size_t round_size = n; round_size > 1; round_size >>= 1) {
+        FF expected = pow_univariate.partial_evaluation_constant;
+        for (size_t i = 0; i < (round_size >> 1); ++i) {
+            EXPECT_EQ(pow_univariate.get_pow_challenge(i), expected);
+            expected *= pow_univariate.zeta_pow_sqr;
+        }
+        pow_univariate.partially_evaluate(FF::random_element());
+    }
+}
 } // namespace barretenberg::test_pow
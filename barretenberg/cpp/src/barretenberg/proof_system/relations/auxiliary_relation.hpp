@@ -21,6 +21,9 @@ template <typename FF_> class AuxiliaryRelationImpl {
     template <template <size_t...> typename SubrelationAccumulatorsTemplate>
     using GetAccumulatorTypes = SubrelationAccumulatorsTemplate<LEN_1, LEN_2, LEN_3, LEN_4, LEN_5, LEN_6>;
 
+    // Every subrelation is a multiple of q_aux, so the relation vanishes on any edge where q_aux does
+    static const auto& get_gating_selector(const auto& polynomials) { return polynomials.q_aux; }
+
     /**
      * @brief Expression for the generalized permutation sort gate.
      * @details The following explanation is reproduced from the Plonk analog 'plookup_auxiliary_widget':
@@ -19,6 +19,9 @@ template <typename FF_> class EllipticRelationImpl {
     template <template <size_t...> typename SubrelationAccumulatorsTemplate>
     using GetAccumulatorTypes = SubrelationAccumulatorsTemplate<LEN_1, LEN_2>;
 
+    // Every subrelation is a multiple of q_elliptic, so the relation vanishes on any edge where q_elliptic does
+    static const auto& get_gating_selector(const auto& polynomials) { return polynomials.q_elliptic; }
+
     // TODO(@zac-williamson #2609 find more generic way of doing this)
     static constexpr FF get_curve_b()
     {
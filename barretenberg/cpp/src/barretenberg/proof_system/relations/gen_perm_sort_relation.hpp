@@ -18,6 +18,9 @@ template <typename FF_> class GenPermSortRelationImpl {
     template <template <size_t...> typename SubrelationAccumulatorsTemplate>
     using GetAccumulatorTypes = SubrelationAccumulatorsTemplate<LEN_1, LEN_2, LEN_3, LEN_4>;
 
+    // Every subrelation is a multiple of q_sort, so the relation vanishes on any edge where q_sort does
+    static const auto& get_gating_selector(const auto& polynomials) { return polynomials.q_sort; }
+
     /**
      * @brief Expression for the generalized permutation sort gate.
      * @details The relation is defined as C(extended_edges(X)...) =
@@ -117,6 +117,23 @@ template <typename RelationImpl> class Relation : public RelationImpl {
             accumulator, input, relation_parameters, scaling_factor);
     }
 
+    /**
+     * @brief Whether the relation contributes nothing on the edge between rows `edge_idx` and `edge_idx + 1`
+     *
+     * @details A relation whose every subrelation is a multiple of one selector names that selector with a static
+     * `get_gating_selector`. Where the selector is zero on both rows its extension along the edge is identically zero,
+     * so the edge can be skipped. Relations without a gating selector are active on every edge.
+     */
+    static bool is_inactive_on_edge(const auto& polynomials, const size_t edge_idx)
+    {
+        if constexpr (requires { RelationImpl::get_gating_selector(polynomials); }) {
+            const auto& selector = RelationImpl::get_gating_selector(polynomials);
+            return selector[edge_idx].is_zero() && selector[edge_idx + 1].is_zero();
+        } else {
+            return false;
+        }
+    }
+
     static void add_full_relation_value_contribution(RelationValues& accumulator,
                                                      auto& input,
                                                      const RelationParameters<FF>& relation_parameters,
@@ -16,6 +16,9 @@ template <typename FF_> class UltraArithmeticRelationImpl {
     template <template <size_t...> typename SubrelationAccumulatorsTemplate>
     using GetAccumulatorTypes = SubrelationAccumulatorsTemplate<LEN_1, LEN_2>;
 
+    // Both subrelations are multiples of q_arith, so the relation vanishes on any edge where q_arith does
+    static const auto& get_gating_selector(const auto& polynomials) { return polynomials.q_arith; }
+
     /**
      * @brief Expression for the Ultra Arithmetic gate.
      * @details This relation encapsulates several idenitities, toggled by the value of q_arith in [0, 1, 2, 3, ...].
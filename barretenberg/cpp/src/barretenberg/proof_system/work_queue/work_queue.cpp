@@ -1,12 +1,86 @@
 #include "work_queue.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <span>
+#include <unordered_map>
+#include <vector>
 
 namespace proof_system::plonk {
 
 using namespace barretenberg;
 
+namespace {
+
+#if defined(NO_MULTITHREADING) || !defined(NO_OMP_MULTITHREADING)
+// Only the work-stealing parallel_for shares the cores between nested loops; with the others the (i)FFTs and MSMs would
+// each be left with a single thread, so independent batches are run one after another.
+constexpr bool run_independent_work_concurrently = false;
+#else
+constexpr bool run_independent_work_concurrently = true;
+#endif
+
+/**
+ * @brief A batch of work items processed as one unit
+ */
+struct WorkGroup {
+    std::function<void()> run;
+    // Indices of the groups that must finish before this one starts
+    std::vector<size_t> dependencies;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point end;
+};
+
+/**
+ * @brief Run every group once its dependencies have finished
+ *
+ * @details The groups without dependencies are started together, as the iterations of one parallel_for. Each of them
+ * parallelises internally, and the work-stealing pool shares the cores between them, so e.g. a memory-bound MSM
+ * overlaps a compute-bound FFT rather than waiting for it. A group with dependencies is run by the thread that
+ * finishes the last of them.
+ */
+void run_work_groups(std::vector<WorkGroup>& groups)
+{
+    const size_t num_groups = groups.size();
+    std::vector<std::vector<size_t>> dependents(num_groups);
+    std::vector<std::atomic<size_t>> num_pending_dependencies(num_groups);
+    std::vector<size_t> roots;
+    for (size_t i = 0; i < num_groups; ++i) {
+        num_pending_dependencies[i] = groups[i].dependencies.size();
+        for (size_t dependency : groups[i].dependencies) {
+            dependents[dependency].push_back(i);
+        }
+        if (groups[i].dependencies.empty()) {
+            roots.push_back(i);
+        }
+    }
+
+    std::function<void(size_t)> run_group = [&](size_t i) {
+        groups[i].start = std::chrono::steady_clock::now();
+        groups[i].run();
+        groups[i].end = std::chrono::steady_clock::now();
+        for (size_t dependent : dependents[i]) {
+            if (num_pending_dependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                run_group(dependent);
+            }
+        }
+    };
+
+    if constexpr (run_independent_work_concurrently) {
+        parallel_for(roots.size(), [&](size_t i) { run_group(roots[i]); });
+    } else {
+        for (size_t root : roots) {
+            run_group(root);
+        }
+    }
+}
+
+} // namespace
+
 work_queue::work_queue(proving_key* prover_key, transcript::StandardTranscript* prover_transcript)
     : key(prover_key)
     , transcript(prover_transcript)
@@ -201,6 +275,26 @@ void work_queue::add_to_queue(const work_item& item)
 
 void work_queue::process_queue()
 {
+    // Scalar multiplications are all over the monomial srs, so we gather them up and evaluate them as a single batch
+    std::vector<std::span<const fr>> msm_scalars;
+    std::vector<const work_item*> msm_items;
+    // Likewise, (i)FFTs all share a domain, so we transform them in lockstep and load each twiddle factor once
+    std::vector<polynomial> ifft_polys;
+    std::vector<const work_item*> ifft_items;
+    std::vector<polynomial> fft_polys;
+    std::vector<const work_item*> fft_items;
+    // FFTs of polynomials whose monomial form is computed by an IFFT in this queue have to wait for the IFFT batch
+    std::vector<size_t> dependent_fft_sources;
+    std::vector<const work_item*> dependent_fft_items;
+
+    std::unordered_map<std::string, size_t> ifft_indices;
+    size_t num_iffts = 0;
+    for (const auto& item : work_item_queue) {
+        if (item.work_type == WorkType::IFFT) {
+            ifft_indices[item.tag] = num_iffts++;
+        }
+    }
+
     for (const auto& item : work_item_queue) {
         switch (item.work_type) {
         // most expensive op
@@ -210,14 +304,8 @@ void work_queue::process_queue()
 
             ASSERT(msm_size <= key->reference_string->get_monomial_size());
 
-            barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
-
-            // Run pippenger multi-scalar multiplication.
-            auto runtime_state = barretenberg::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
-            barretenberg::g1::affine_element result(barretenberg::scalar_multiplication::pippenger_unsafe<curve::BN254>(
-                item.mul_scalars.get(), srs_points, msm_size, runtime_state));
-
-            transcript->add_element(item.tag, result.to_buffer());
+            msm_scalars.emplace_back(item.mul_scalars.get(), msm_size);
+            msm_items.emplace_back(&item);
 
             break;
         }
@@ -249,36 +337,121 @@ void work_queue::process_queue()
         //     break;
         // }
         case WorkType::FFT: {
-            using namespace barretenberg;
-            auto wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
-
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
+            if (auto source = ifft_indices.find(item.tag); source != ifft_indices.end()) {
+                dependent_fft_sources.emplace_back(source->second);
+                dependent_fft_items.emplace_back(&item);
+                break;
             }
-
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-
+            auto wire = key->polynomial_store.get(item.tag);
+            fft_polys.emplace_back(wire, 4 * key->circuit_size + 4);
+            fft_items.emplace_back(&item);
             break;
         }
         // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
         case WorkType::IFFT: {
-            using namespace barretenberg;
             // retrieve wire in lagrange form
             auto wire_lagrange = key->polynomial_store.get(item.tag + "_lagrange");
-
-            // Compute wire monomial form via ifft on lagrange form then add it to the store
-            polynomial wire_monomial(key->circuit_size);
-            polynomial_arithmetic::ifft((fr*)&wire_lagrange[0], &wire_monomial[0], key->small_domain);
-            key->polynomial_store.put(item.tag, std::move(wire_monomial));
-
+            polynomial& wire_monomial = ifft_polys.emplace_back(key->circuit_size);
+            polynomial_arithmetic::copy_polynomial(
+                &wire_lagrange[0], &wire_monomial[0], key->circuit_size, key->circuit_size);
+            ifft_items.emplace_back(&item);
             break;
         }
         default: {
         }
         }
     }
+
+    // Coset FFT a batch of polynomials of size 4n + 4, then copy the first 4 evaluations to the end
+    auto coset_fft = [&](std::vector<polynomial>& polys) {
+        std::vector<fr*> fft_data;
+        for (auto& poly : polys) {
+            fft_data.emplace_back(poly.data().get());
+        }
+        polynomial_arithmetic::batch_coset_fft(fft_data, key->large_domain);
+        for (auto& poly : polys) {
+            for (size_t j = 0; j < 4; j++) {
+                poly[4 * key->circuit_size + j] = poly[j];
+            }
+        }
+    };
+
+    // The groups only compute; the polynomial store and the transcript are not thread safe, so their results are
+    // written out once every group has finished.
+    std::vector<WorkGroup> groups;
+    std::unordered_map<const work_item*, size_t> item_groups;
+    auto add_group = [&](const std::vector<const work_item*>& items, std::function<void()> run) {
+        for (const auto* item : items) {
+            item_groups[item] = groups.size();
+        }
+        groups.push_back({ std::move(run), {}, {}, {} });
+        return groups.size() - 1;
+    };
+
+    std::vector<polynomial> dependent_fft_polys;
+    if (!ifft_items.empty()) {
+        // Compute wire monomial forms via ifft on the lagrange forms
+        const size_t ifft_group = add_group(ifft_items, [&]() {
+            std::vector<fr*> ifft_data;
+            for (auto& poly : ifft_polys) {
+                ifft_data.emplace_back(poly.data().get());
+            }
+            polynomial_arithmetic::batch_ifft(ifft_data, key->small_domain);
+        });
+        if (!dependent_fft_items.empty()) {
+            const size_t dependent_fft_group = add_group(dependent_fft_items, [&]() {
+                for (size_t source : dependent_fft_sources) {
+                    dependent_fft_polys.emplace_back(ifft_polys[source], 4 * key->circuit_size + 4);
+                }
+                coset_fft(dependent_fft_polys);
+            });
+            groups[dependent_fft_group].dependencies.push_back(ifft_group);
+        }
+    }
+
+    if (!fft_items.empty()) {
+        add_group(fft_items, [&]() { coset_fft(fft_polys); });
+    }
+
+    std::vector<g1::affine_element> msm_results;
+    if (!msm_items.empty()) {
+        add_group(msm_items, [&]() {
+            // Run pippenger multi-scalar multiplications, borrowing scratch space from the crs' pool.
+            msm_results = scalar_multiplication::pippenger_batch_unsafe<curve::BN254>(
+                msm_scalars,
+                key->reference_string->get_monomial_points(),
+                key->reference_string->pippenger_runtime_states);
+        });
+    }
+
+    const auto queue_start = std::chrono::steady_clock::now();
+    run_work_groups(groups);
+
+    for (size_t i = 0; i < ifft_items.size(); ++i) {
+        key->polynomial_store.put(ifft_items[i]->tag, std::move(ifft_polys[i]));
+    }
+    for (size_t i = 0; i < fft_items.size(); ++i) {
+        key->polynomial_store.put(fft_items[i]->tag + "_fft", std::move(fft_polys[i]));
+    }
+    for (size_t i = 0; i < dependent_fft_items.size(); ++i) {
+        key->polynomial_store.put(dependent_fft_items[i]->tag + "_fft", std::move(dependent_fft_polys[i]));
+    }
+    for (size_t i = 0; i < msm_items.size(); ++i) {
+        transcript->add_element(msm_items[i]->tag, msm_results[i].to_buffer());
+    }
+
+    auto offset_us = [&](std::chrono::steady_clock::time_point time) {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(time - queue_start).count());
+    };
+    work_item_timings.clear();
+    for (const auto& item : work_item_queue) {
+        if (auto group = item_groups.find(&item); group != item_groups.end()) {
+            const WorkGroup& work_group = groups[group->second];
+            work_item_timings.push_back(
+                { item.work_type, item.tag, offset_us(work_group.start), offset_us(work_group.end) });
+        }
+    }
     work_item_queue = std::vector<work_item>();
 }
 
@@ -287,4 +460,9 @@ std::vector<work_queue::work_item> work_queue::get_queue() const
     return work_item_queue;
 }
 
+std::vector<work_queue::work_item_timing> work_queue::get_work_item_timings() const
+{
+    return work_item_timings;
+}
+
 } // namespace proof_system::plonk
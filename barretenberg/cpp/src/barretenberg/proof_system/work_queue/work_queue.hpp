@@ -32,6 +32,14 @@ class work_queue {
         barretenberg::fr shift_factor;
     };
 
+    struct work_item_timing {
+        WorkType work_type;
+        std::string tag;
+        // Offsets from the start of process_queue, in microseconds. Items processed as one batch share a timing.
+        uint64_t start_us;
+        uint64_t end_us;
+    };
+
     work_queue(proving_key* prover_key = nullptr, transcript::StandardTranscript* prover_transcript = nullptr);
 
     work_queue(const work_queue& other) = default;
@@ -63,9 +71,16 @@ class work_queue {
 
     std::vector<work_item> get_queue() const;
 
+    /**
+     * @brief Timings of the work items run by the last call to process_queue, in queue order
+     * @details The latest end time is the length of the critical path through the queue.
+     */
+    std::vector<work_item_timing> get_work_item_timings() const;
+
   private:
     proving_key* key;
     transcript::StandardTranscript* transcript;
     std::vector<work_item> work_item_queue;
+    std::vector<work_item_timing> work_item_timings;
 };
 } // namespace proof_system::plonk
\ No newline at end of file
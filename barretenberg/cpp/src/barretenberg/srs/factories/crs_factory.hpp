@@ -4,6 +4,7 @@
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/bn254/g2.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/runtime_states.hpp"
 #include <cstddef>
 
 namespace barretenberg::pairing {
@@ -25,6 +26,12 @@ template <typename Curve> class ProverCrs {
      */
     virtual typename Curve::AffineElement* get_monomial_points() = 0;
     virtual size_t get_monomial_size() const = 0;
+
+    /**
+     * @brief Scratch space for MSMs over the monomial points. Lives as long as the crs, so every commitment made
+     * against it (within a proof, and across proofs sharing the crs) reuses the same warm buffers.
+     */
+    scalar_multiplication::pippenger_runtime_state_pool<Curve> pippenger_runtime_states;
 };
 
 template <typename Curve> class VerifierCrs {
@@ -27,13 +27,23 @@ FileVerifierCrs<curve::BN254>::~FileVerifierCrs()
     aligned_free(precomputed_g2_lines);
 }
 
-FileVerifierCrs<curve::Grumpkin>::FileVerifierCrs(std::string const& path, const size_t num_points)
+FileVerifierCrs<curve::Grumpkin>::FileVerifierCrs(std::string const& path,
+                                                   const size_t num_points,
+                                                   bool cache_point_table)
     : num_points(num_points)
 {
     using Curve = curve::Grumpkin;
-    monomials_ = scalar_multiplication::point_table_alloc<Curve::AffineElement>(num_points);
-    srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
-    scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+    if (cache_point_table) {
+        monomials_ = srs::IO<Curve>::map_point_table(num_points, path);
+    }
+    if (!monomials_) {
+        monomials_ = scalar_multiplication::point_table_alloc<Curve::AffineElement>(num_points);
+        srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+        if (cache_point_table) {
+            srs::IO<Curve>::write_point_table(monomials_.get(), num_points, path);
+        }
+    }
     first_g1 = monomials_[0];
 };
 
@@ -48,16 +58,17 @@ size_t FileVerifierCrs<curve::Grumpkin>::get_monomial_size() const
 }
 
 template <typename Curve>
-FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
+FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree, bool cache_point_table)
     : path_(std::move(path))
     , degree_(initial_degree)
+    , cache_point_table_(cache_point_table)
 {}
 
 template <typename Curve>
 std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get_prover_crs(size_t degree)
 {
     if (degree != degree_ || !prover_crs_) {
-        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_, cache_point_table_);
         degree_ = degree;
     }
     return prover_crs_;
@@ -67,7 +78,11 @@ template <typename Curve>
 std::shared_ptr<barretenberg::srs::factories::VerifierCrs<Curve>> FileCrsFactory<Curve>::get_verifier_crs(size_t degree)
 {
     if (degree != degree_ || !verifier_crs_) {
-        verifier_crs_ = std::make_shared<FileVerifierCrs<Curve>>(path_, degree);
+        if constexpr (std::same_as<Curve, curve::Grumpkin>) {
+            verifier_crs_ = std::make_shared<FileVerifierCrs<Curve>>(path_, degree, cache_point_table_);
+        } else {
+            verifier_crs_ = std::make_shared<FileVerifierCrs<Curve>>(path_, degree);
+        }
         degree_ = degree;
     }
     return verifier_crs_;
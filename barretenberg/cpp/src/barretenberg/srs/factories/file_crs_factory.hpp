@@ -12,10 +12,11 @@ namespace barretenberg::srs::factories {
 
 /**
  * Create reference strings given a path to a directory of transcript files.
+ * If cache_point_table is set, the pippenger point table is cached next to the transcripts (see PointTableHeader).
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
-    FileCrsFactory(std::string path, size_t initial_degree = 0);
+    FileCrsFactory(std::string path, size_t initial_degree = 0, bool cache_point_table = false);
     FileCrsFactory(FileCrsFactory&& other) = default;
 
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> get_prover_crs(size_t degree) override;
@@ -25,19 +26,35 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   private:
     std::string path_;
     size_t degree_;
+    bool cache_point_table_;
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> prover_crs_;
     std::shared_ptr<barretenberg::srs::factories::VerifierCrs<Curve>> verifier_crs_;
 };
 
 template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
   public:
-    FileProverCrs(const size_t num_points, std::string const& path)
+    /**
+     * @brief Builds the point table from the transcripts in `path`
+     * @details If cache_point_table is set, a cached point table in `path` that is large enough is mapped instead.
+     * Failing that, the table built from the transcripts is cached, so that later provers using the same srs skip
+     * both the transcript read and the table generation.
+     */
+    FileProverCrs(const size_t num_points, std::string const& path, bool cache_point_table = false)
         : num_points(num_points)
     {
+        if (cache_point_table) {
+            monomials_ = srs::IO<Curve>::map_point_table(num_points, path);
+            if (monomials_) {
+                return;
+            }
+        }
         monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
 
         srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
         scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+        if (cache_point_table) {
+            srs::IO<Curve>::write_point_table(monomials_.get(), num_points, path);
+        }
     };
 
     typename Curve::AffineElement* get_monomial_points() { return monomials_.get(); }
@@ -74,7 +91,7 @@ template <> class FileVerifierCrs<curve::Grumpkin> : public VerifierCrs<curve::G
     using Curve = curve::Grumpkin;
 
   public:
-    FileVerifierCrs(std::string const& path, const size_t num_points);
+    FileVerifierCrs(std::string const& path, const size_t num_points, bool cache_point_table = false);
     virtual ~FileVerifierCrs() = default;
     Curve::AffineElement* get_monomial_points() const override;
     size_t get_monomial_size() const override;
@@ -2,11 +2,20 @@
 #include "./factories/file_crs_factory.hpp"
 #include "./factories/mem_crs_factory.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include <cstdlib>
 
 namespace {
 // TODO(#637): As a PoC we have two global variables for the two CRS but this could be improved to avoid duplication.
 std::shared_ptr<barretenberg::srs::factories::CrsFactory<curve::BN254>> crs_factory;
 std::shared_ptr<barretenberg::srs::factories::CrsFactory<curve::Grumpkin>> grumpkin_crs_factory;
+
+// File-backed crs factories only cache their pippenger point table next to the transcripts if BB_CACHE_POINT_TABLE
+// is set, as the cache takes as much disk space as the table itself
+bool cache_point_table()
+{
+    const char* env_value = std::getenv("BB_CACHE_POINT_TABLE");
+    return env_value != nullptr && *env_value != 0;
+}
 } // namespace
 
 namespace barretenberg::srs {
@@ -20,12 +29,13 @@ void init_crs_factory(std::vector<g1::affine_element> const& points, g2::affine_
 // Initialises crs from a file path this we use in the entire codebase
 void init_crs_factory(std::string crs_path)
 {
-    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path);
+    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path, 0, cache_point_table());
 }
 
 void init_grumpkin_crs_factory(std::string crs_path)
 {
-    grumpkin_crs_factory = std::make_shared<factories::FileCrsFactory<curve::Grumpkin>>(crs_path);
+    grumpkin_crs_factory =
+        std::make_shared<factories::FileCrsFactory<curve::Grumpkin>>(crs_path, 0, cache_point_table());
 }
 
 std::shared_ptr<factories::CrsFactory<curve::BN254>> get_crs_factory()
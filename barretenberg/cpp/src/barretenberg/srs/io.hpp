@@ -1,11 +1,18 @@
 #pragma once
 #include "../ecc/curves/bn254/bn254.hpp"
 #include "../ecc/curves/grumpkin/grumpkin.hpp"
+#include "../ecc/scalar_multiplication/point_table.hpp"
 #include <concepts>
 #include <cstdint>
+#include <cstdio>
 #include <fstream>
 #include <string>
 #include <sys/stat.h>
+#if !defined(__wasm__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 namespace barretenberg::srs {
 /**
@@ -45,6 +52,39 @@ struct Manifest {
     uint32_t start_from;
 };
 
+/**
+ * @brief The header of a point table file, which caches the pippenger point table of the first num_points G1 points
+ *
+ * @details Unlike a transcript, a point table file is stored in the native layout of the prover: the header is
+ * followed by the 2 * num_points affine elements produced by generate_pippenger_point_table, in Montgomery form and
+ * native byte order, so it can be memory-mapped and used in place. The magic value doubles as a byte order check.
+ * The curve id is the low limb of the base field modulus, since BN254 and Grumpkin points have the same size. The
+ * transcript fingerprint covers the size and modification time of the transcripts the table was built from, so a
+ * table goes stale when they are replaced.
+ *
+ * 00   | XX XX XX XX XX XX XX XX | Magic ("BBPTABLE")
+ * 08   | XX XX XX XX             | Format version
+ * 0C   | XX XX XX XX             | Size of an affine element
+ * 10   | XX XX XX XX XX XX XX XX | Number of G1 points (num_points)
+ * 18   | XX XX XX XX XX XX XX XX | Curve id
+ * 20   | XX XX XX XX XX XX XX XX | Transcript fingerprint
+ * 28   | 00 ... 00               | Padding up to 0x40, keeping the elements aligned
+ * 40   | XX XX XX XX             | 2 * num_points affine elements
+ */
+struct PointTableHeader {
+    static constexpr uint64_t MAGIC = 0x454c424154504242; // "BBPTABLE" in little-endian byte order
+    static constexpr uint32_t VERSION = 2;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t element_size;
+    uint64_t num_points;
+    uint64_t curve_id;
+    uint64_t transcript_fingerprint;
+    uint8_t padding[24];
+};
+static_assert(sizeof(PointTableHeader) == 64);
+
 // Detect whether a curve has a G2AffineElement defined
 template <typename Curve>
 concept HasG2 = requires { typename Curve::G2AffineElement; };
@@ -367,6 +407,125 @@ template <typename Curve> class IO {
         read_transcript_g1(monomials, degree, path);
     }
 
+    static std::string get_point_table_path(std::string const& dir)
+    {
+        return format(dir, "/monomial/pippenger_point_table.dat");
+    }
+
+    static constexpr uint64_t get_point_table_curve_id() { return Fq::modulus.data[0]; }
+
+    /**
+     * @brief Hashes the size and modification time of every transcript in `dir`, so that a cached point table is
+     * rebuilt when the transcripts it came from change
+     */
+    static uint64_t get_transcript_fingerprint(std::string const& dir)
+    {
+        uint64_t fingerprint = 0xcbf29ce484222325; // FNV-1a offset basis
+        const auto mix = [&fingerprint](uint64_t value) {
+            fingerprint ^= value;
+            fingerprint *= 0x100000001b3; // FNV-1a prime
+        };
+        struct stat st;
+        for (size_t num = 0; stat(get_transcript_path(dir, num).c_str(), &st) == 0; ++num) {
+            mix(static_cast<uint64_t>(st.st_size));
+            mix(static_cast<uint64_t>(st.st_mtim.tv_sec));
+            mix(static_cast<uint64_t>(st.st_mtim.tv_nsec));
+        }
+        return fingerprint;
+    }
+
+    /**
+     * @brief Maps the point table file in `dir` into memory, if it holds a table for at least `num_points` points
+     *
+     * @details The file is mapped copy-on-write over an anonymous reservation of the size point_table_alloc would
+     * give, so the prefetch overflow past the end of the table is still backed. Pages that are never written stay
+     * shared with the page cache, and so with every other process that maps the same file. Returns nullptr if the
+     * file is missing, was built for another curve or from other transcripts, or is too small, in which case the
+     * caller should build the table from the transcripts.
+     */
+    static std::shared_ptr<AffineElement[]> map_point_table(size_t num_points, std::string const& dir)
+    {
+#if defined(__wasm__)
+        static_cast<void>(num_points);
+        static_cast<void>(dir);
+        return nullptr;
+#else
+        const std::string path = get_point_table_path(dir);
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        PointTableHeader header;
+        const size_t table_size = sizeof(PointTableHeader) + 2 * num_points * sizeof(AffineElement);
+        const bool valid = pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+                           header.magic == PointTableHeader::MAGIC && header.version == PointTableHeader::VERSION &&
+                           header.element_size == sizeof(AffineElement) && header.num_points >= num_points &&
+                           header.curve_id == get_point_table_curve_id() &&
+                           header.transcript_fingerprint == get_transcript_fingerprint(dir) &&
+                           get_file_size(path) >= table_size;
+        if (!valid) {
+            close(fd);
+            return nullptr;
+        }
+
+        const size_t mapping_size = sizeof(PointTableHeader) + scalar_multiplication::point_table_buf_size(num_points);
+        void* reservation = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (reservation == MAP_FAILED) {
+            close(fd);
+            return nullptr;
+        }
+        void* mapping = mmap(reservation, table_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0);
+        close(fd);
+        if (mapping == MAP_FAILED) {
+            munmap(reservation, mapping_size);
+            return nullptr;
+        }
+
+        auto* elements = reinterpret_cast<AffineElement*>(static_cast<char*>(mapping) + sizeof(PointTableHeader));
+        return std::shared_ptr<AffineElement[]>(
+            elements, [mapping, mapping_size](AffineElement*) { munmap(mapping, mapping_size); });
+#endif
+    }
+
+    /**
+     * @brief Writes the pippenger point table of `num_points` points to the point table file in `dir`
+     *
+     * @details The file is written under a temporary name and renamed into place, so concurrent provers never map a
+     * partially written table. A larger table already in place is kept. This is a cache: failures are ignored.
+     */
+    static void write_point_table(AffineElement const* table, size_t num_points, std::string const& dir)
+    {
+#if defined(__wasm__)
+        static_cast<void>(table);
+        static_cast<void>(num_points);
+        static_cast<void>(dir);
+#else
+        const std::string path = get_point_table_path(dir);
+        if (map_point_table(num_points, dir) != nullptr) {
+            return;
+        }
+
+        PointTableHeader header{};
+        header.magic = PointTableHeader::MAGIC;
+        header.version = PointTableHeader::VERSION;
+        header.element_size = sizeof(AffineElement);
+        header.num_points = num_points;
+        header.curve_id = get_point_table_curve_id();
+        header.transcript_fingerprint = get_transcript_fingerprint(dir);
+
+        const std::string temp_path = format(path, ".", getpid(), ".tmp");
+        std::ofstream file(temp_path, std::ofstream::binary);
+        file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        file.write(reinterpret_cast<char const*>(table),
+                   static_cast<std::streamsize>(2 * num_points * sizeof(AffineElement)));
+        file.close();
+        if (!file || std::rename(temp_path.c_str(), path.c_str()) != 0) {
+            std::remove(temp_path.c_str());
+        }
+#endif
+    }
+
     // This function is a vestige of the Lagrange form transcript work, and it is not used anywhere.
     static void write_transcript(AffineElement const* g1_x,
                                  auto const* g2_x,
@@ -2,6 +2,10 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/ecc/curves/bn254/fq12.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include <filesystem>
+#include <fstream>
 #include <gtest/gtest.h>
 
 using namespace barretenberg;
@@ -30,3 +34,37 @@ TEST(io, read_transcript_loads_well_formed_srs)
     }
     aligned_free(monomials);
 }
+
+TEST(io, point_table_round_trip)
+{
+    using IO = srs::IO<curve::BN254>;
+    const size_t num_points = 1024;
+    auto table = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    IO::read_transcript_g1(table.get(), num_points, "../srs_db/ignition");
+    scalar_multiplication::generate_pippenger_point_table<curve::BN254>(table.get(), table.get(), num_points);
+
+    auto dir = std::filesystem::temp_directory_path() / format("point_table_test_", getpid());
+    std::filesystem::create_directories(dir / "monomial");
+    EXPECT_EQ(IO::map_point_table(num_points, dir), nullptr);
+
+    IO::write_point_table(table.get(), num_points, dir);
+    {
+        auto mapped = IO::map_point_table(num_points, dir);
+        ASSERT_NE(mapped, nullptr);
+        for (size_t i = 0; i < 2 * num_points; ++i) {
+            EXPECT_EQ(mapped.get()[i], table.get()[i]);
+        }
+
+        // A smaller table is a prefix of the cached one, but a larger one is not cached yet
+        EXPECT_NE(IO::map_point_table(num_points / 2, dir), nullptr);
+        EXPECT_EQ(IO::map_point_table(2 * num_points, dir), nullptr);
+    }
+
+    // Grumpkin points have the same size, but the table belongs to another curve
+    EXPECT_EQ(srs::IO<curve::Grumpkin>::map_point_table(num_points, dir), nullptr);
+
+    // Adding or replacing a transcript makes the cached table stale
+    std::ofstream(dir / "monomial" / "transcript00.dat") << "transcript";
+    EXPECT_EQ(IO::map_point_table(num_points, dir), nullptr);
+    std::filesystem::remove_all(dir);
+}
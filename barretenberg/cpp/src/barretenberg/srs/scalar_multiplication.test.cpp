@@ -616,7 +616,7 @@ TYPED_TEST(ScalarMultiplicationTests, RadixSort)
 
     // check that our radix sort correctly sorts!
     constexpr size_t target_degree = 1 << 8;
-    constexpr size_t num_rounds = barretenberg::scalar_multiplication::get_num_rounds(target_degree * 2);
+    const size_t num_rounds = barretenberg::scalar_multiplication::get_num_rounds(target_degree * 2);
     Fr* scalars = (Fr*)(aligned_alloc(64, sizeof(Fr) * target_degree));
 
     Fr source_scalar = Fr::random_element();
@@ -1057,3 +1057,421 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerMulByZero)
 
     EXPECT_EQ(result.is_point_at_infinity(), true);
 }
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerRuntimeStatePool)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 1024;
+    std::vector<Fr> scalars(num_points);
+    std::vector<AffineElement> points(num_points * 2 + 1);
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = Fr::random_element();
+        points[i] = AffineElement(Element::random_element());
+        expected += points[i] * scalars[i];
+    }
+    expected = expected.normalize();
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(&points[0], &points[0], num_points);
+
+    barretenberg::scalar_multiplication::pippenger_runtime_state_pool<Curve> pool;
+    barretenberg::scalar_multiplication::pippenger_runtime_state<Curve>* first_state = nullptr;
+    {
+        auto state = pool.acquire(num_points);
+        first_state = state.get();
+        // A second concurrent borrower must not share the first one's scratch space.
+        auto other_state = pool.acquire(num_points / 2);
+        EXPECT_NE(first_state, other_state.get());
+
+        Element result =
+            barretenberg::scalar_multiplication::pippenger<Curve>(&scalars[0], &points[0], num_points, *state);
+        EXPECT_EQ(result.normalize(), expected);
+    }
+    EXPECT_EQ(pool.num_idle_states(), 2UL);
+
+    // The best fitting idle state is reused, rather than a new one being built.
+    {
+        auto state = pool.acquire(num_points);
+        EXPECT_EQ(state.get(), first_state);
+        Element result =
+            barretenberg::scalar_multiplication::pippenger<Curve>(&scalars[0], &points[0], num_points, *state);
+        EXPECT_EQ(result.normalize(), expected);
+    }
+
+    // A large state can serve a smaller MSM.
+    {
+        auto state = pool.acquire(num_points / 4);
+        Element result =
+            barretenberg::scalar_multiplication::pippenger<Curve>(&scalars[0], &points[0], num_points / 4, *state);
+        Element expected_quarter;
+        expected_quarter.self_set_infinity();
+        for (size_t i = 0; i < num_points / 4; ++i) {
+            expected_quarter += points[i * 2] * scalars[i];
+        }
+        EXPECT_EQ(result.normalize(), expected_quarter.normalize());
+    }
+
+    pool.clear();
+    EXPECT_EQ(pool.num_idle_states(), 0UL);
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatchUnsafe)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    // A mix of empty, small (sharing one set of buckets) and large (evaluated in turn) MSMs
+    const std::vector<size_t> msm_sizes = {
+        0, 1, 100, 1024, scalar_multiplication::BATCH_MSM_CONCURRENCY_THRESHOLD + 3, 257, 300, 5000
+    };
+    const size_t num_points = scalar_multiplication::BATCH_MSM_CONCURRENCY_THRESHOLD + 3;
+
+    std::vector<AffineElement> points(num_points * 2 + 1);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(&points[0], &points[0], num_points);
+
+    std::vector<std::vector<Fr>> scalars;
+    std::vector<std::span<const Fr>> scalar_spans;
+    for (const size_t size : msm_sizes) {
+        scalars.emplace_back(size);
+        for (auto& scalar : scalars.back()) {
+            scalar = Fr::random_element();
+        }
+    }
+    // The small MSMs skip zero and one scalars: one of them has no other scalars, one has a few of each
+    for (auto& scalar : scalars[6]) {
+        scalar = Fr::zero();
+    }
+    for (size_t i = 0; i < msm_sizes[7]; i += 3) {
+        scalars[7][i] = (i % 2 == 0) ? Fr::zero() : Fr::one();
+    }
+    for (const auto& msm_scalars : scalars) {
+        scalar_spans.emplace_back(msm_scalars);
+    }
+
+    scalar_multiplication::pippenger_runtime_state_pool<Curve> pool;
+    auto results = scalar_multiplication::pippenger_batch_unsafe<Curve>(scalar_spans, &points[0], pool);
+
+    ASSERT_EQ(results.size(), msm_sizes.size());
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    for (size_t i = 0; i < msm_sizes.size(); ++i) {
+        Element expected =
+            scalar_multiplication::pippenger_unsafe<Curve>(&scalars[i][0], &points[0], msm_sizes[i], state);
+        EXPECT_EQ(results[i], AffineElement(expected));
+    }
+    EXPECT_TRUE(results[0].is_point_at_infinity());
+    EXPECT_TRUE(results[6].is_point_at_infinity());
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatchUnsafeSharedBucketLimit)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    // At the default widths, 2^14 MSMs of 8192 points need 2^24 shared buckets, so they must be split up
+    {
+        const std::vector<size_t> msm_sizes(1UL << 14, 8192);
+        const auto group_ends = scalar_multiplication::get_shared_bucket_msm_groups(msm_sizes);
+        EXPECT_GT(group_ends.size(), 1UL);
+        EXPECT_EQ(group_ends.back(), msm_sizes.size());
+        size_t group_start = 0;
+        for (const size_t group_end : group_ends) {
+            ASSERT_GT(group_end, group_start);
+            const size_t num_msms = group_end - group_start;
+            EXPECT_LT(num_msms << scalar_multiplication::get_optimal_bucket_width(8192),
+                      scalar_multiplication::BATCH_MSM_MAX_SHARED_BUCKETS);
+            group_start = group_end;
+        }
+    }
+
+    // With the widest buckets, a handful of small MSMs already crosses the limit
+    constexpr size_t num_msms = 5;
+    constexpr size_t num_points = 64;
+    scalar_multiplication::bucket_width_profile profile;
+    for (size_t i = 0; i < scalar_multiplication::bucket_width_profile::MAX_LOG_NUM_POINTS; ++i) {
+        profile.set_bucket_width_for_log_size(i, scalar_multiplication::bucket_width_profile::MAX_BUCKET_WIDTH);
+    }
+    profile.normalize();
+    scalar_multiplication::set_bucket_width_profile(profile);
+    EXPECT_GE(num_msms << scalar_multiplication::get_optimal_bucket_width(num_points),
+              scalar_multiplication::BATCH_MSM_MAX_SHARED_BUCKETS);
+
+    std::vector<AffineElement> points(num_points * 2 + 1);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    std::vector<AffineElement> base_points(points.begin(), points.begin() + num_points);
+    scalar_multiplication::generate_pippenger_point_table<Curve>(&points[0], &points[0], num_points);
+
+    // Scalars a little below a multiple of the wnaf window put both positive and negative digits into the lowest
+    // buckets, which keeps folding the others cheap
+    constexpr uint64_t wnaf_window = 1ULL << (scalar_multiplication::bucket_width_profile::MAX_BUCKET_WIDTH + 1);
+    std::vector<std::vector<Fr>> scalars(num_msms, std::vector<Fr>(num_points));
+    std::vector<std::span<const Fr>> scalar_spans;
+    for (auto& msm_scalars : scalars) {
+        for (auto& scalar : msm_scalars) {
+            const uint64_t low_digit = 2 * static_cast<uint64_t>(engine.get_random_uint8()) + 1;
+            scalar = Fr(wnaf_window * (engine.get_random_uint8() + 1ULL) - low_digit);
+        }
+        scalar_spans.emplace_back(msm_scalars);
+    }
+
+    scalar_multiplication::pippenger_runtime_state_pool<Curve> pool;
+    auto results = scalar_multiplication::pippenger_batch_unsafe<Curve>(scalar_spans, &points[0], pool);
+    scalar_multiplication::set_bucket_width_profile(std::nullopt);
+
+    ASSERT_EQ(results.size(), num_msms);
+    for (size_t i = 0; i < num_msms; ++i) {
+        Element expected;
+        expected.self_set_infinity();
+        for (size_t j = 0; j < num_points; ++j) {
+            expected += base_points[j] * scalars[i][j];
+        }
+        EXPECT_EQ(results[i], AffineElement(expected));
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerSparseUnsafe)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+    std::vector<AffineElement> points(num_points * 2 + 1);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(&points[0], &points[0], num_points);
+
+    // Inputs of different shapes: all zero, all one, mostly empty, dense with some trivial scalars, and partially
+    // filled with trailing zeroes (e.g. a polynomial allocated to the circuit size). The last one is too dense to be
+    // compacted, so only its trailing zeroes are trimmed.
+    const auto make_scalars = [&](auto&& generator) {
+        std::vector<Fr> scalars(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            scalars[i] = generator(i);
+        }
+        return scalars;
+    };
+    std::vector<std::vector<Fr>> test_scalars;
+    test_scalars.emplace_back(make_scalars([](size_t) { return Fr::zero(); }));
+    test_scalars.emplace_back(make_scalars([](size_t) { return Fr::one(); }));
+    test_scalars.emplace_back(make_scalars([](size_t i) {
+        if (i % 64 == 0) {
+            return Fr::random_element();
+        }
+        return (i % 64 == 1) ? Fr::one() : Fr::zero();
+    }));
+    test_scalars.emplace_back(make_scalars([](size_t i) {
+        if (i % 100 == 0) {
+            return Fr::zero();
+        }
+        return (i % 100 == 1) ? Fr::one() : Fr::random_element();
+    }));
+    test_scalars.emplace_back(make_scalars([](size_t i) { return i < 5000 ? Fr::random_element() : Fr::zero(); }));
+    test_scalars.emplace_back(
+        make_scalars([](size_t i) { return i < num_points - 100 ? Fr::random_element() : Fr::zero(); }));
+
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    for (auto& scalars : test_scalars) {
+        Element expected = scalar_multiplication::pippenger<Curve>(&scalars[0], &points[0], num_points, state);
+        Element result =
+            scalar_multiplication::pippenger_sparse_unsafe<Curve>(&scalars[0], &points[0], num_points, state);
+        EXPECT_EQ(result.normalize(), expected.normalize());
+    }
+}
+
+TEST(ScalarMultiplicationBucketWidthProfile, SerializationAndNormalization)
+{
+    using scalar_multiplication::bucket_width_profile;
+
+    // The default profile matches the default ladder at every power of two, and is already normalized
+    bucket_width_profile profile;
+    for (size_t i = 0; i < bucket_width_profile::MAX_LOG_NUM_POINTS; ++i) {
+        EXPECT_EQ(profile.get_bucket_width_for_log_size(i), scalar_multiplication::get_default_bucket_width(1ULL << i));
+    }
+    EXPECT_TRUE(profile.is_normalized());
+    EXPECT_EQ(bucket_width_profile::from_string(profile.to_string()), profile);
+
+    // Entries that are missing keep their default widths. Widths must not shrink as the MSM grows, and small sizes
+    // are widened until halving the MSM size at most doubles the number of rounds.
+    auto parsed = bucket_width_profile::from_string("# comment\n10 12\n\n11 8 # trailing comment\n3 1\n4 12\n");
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_TRUE(parsed->is_normalized());
+    EXPECT_EQ(parsed->get_bucket_width_for_log_size(10), 12UL);
+    EXPECT_EQ(parsed->get_bucket_width_for_log_size(11), 12UL);
+    EXPECT_GE(parsed->get_bucket_width_for_log_size(3), 6UL);
+    EXPECT_EQ(parsed->get_bucket_width((1ULL << 20) + 7), scalar_multiplication::get_default_bucket_width(1ULL << 20));
+
+    EXPECT_FALSE(bucket_width_profile::from_string("10").has_value());
+    EXPECT_FALSE(bucket_width_profile::from_string("10 12 13").has_value());
+    EXPECT_FALSE(bucket_width_profile::from_string("32 12").has_value());
+    EXPECT_FALSE(bucket_width_profile::from_string("10 0").has_value());
+    EXPECT_FALSE(bucket_width_profile::from_string("10 23").has_value());
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerWithBucketWidthProfile)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 3000;
+    std::vector<AffineElement> points(num_points * 2 + 1);
+    std::vector<Fr> scalars(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+        scalars[i] = Fr::random_element();
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(&points[0], &points[0], num_points);
+
+    Element expected;
+    {
+        scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+        expected = scalar_multiplication::pippenger<Curve>(&scalars[0], &points[0], num_points, state);
+    }
+
+    // Park a state sized for the default widths in the pool, then switch to much wider buckets. The pool must not hand
+    // the undersized state back out.
+    scalar_multiplication::pippenger_runtime_state_pool<Curve> pool;
+    pool.acquire(num_points);
+    EXPECT_EQ(pool.num_idle_states(), 1UL);
+
+    scalar_multiplication::bucket_width_profile profile;
+    for (size_t i = 0; i < scalar_multiplication::bucket_width_profile::MAX_LOG_NUM_POINTS; ++i) {
+        profile.set_bucket_width_for_log_size(i, 13);
+    }
+    profile.normalize();
+    scalar_multiplication::set_bucket_width_profile(profile);
+    EXPECT_EQ(scalar_multiplication::get_optimal_bucket_width(num_points), 13UL);
+
+    {
+        auto state = pool.acquire(num_points);
+        EXPECT_TRUE(state->can_serve(num_points));
+        EXPECT_EQ(pool.num_idle_states(), 1UL);
+        Element result = scalar_multiplication::pippenger<Curve>(&scalars[0], &points[0], num_points, *state);
+        EXPECT_EQ(result.normalize(), expected.normalize());
+    }
+
+    scalar_multiplication::set_bucket_width_profile(std::nullopt);
+    EXPECT_EQ(scalar_multiplication::get_optimal_bucket_width(num_points),
+              scalar_multiplication::get_default_bucket_width(num_points));
+}
+
+TYPED_TEST(ScalarMultiplicationTests, CalibrateBucketWidths)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    constexpr size_t num_points = 1 << 9;
+    std::vector<AffineElement> points(num_points * 2 + 1);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(&points[0], &points[0], num_points);
+
+    auto profile = scalar_multiplication::calibrate_bucket_widths<Curve>(&points[0], num_points, 1);
+    EXPECT_TRUE(profile.is_normalized());
+    // Calibration must leave the active profile as it found it
+    EXPECT_FALSE(scalar_multiplication::get_bucket_width_profile().has_value());
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerSignedDigit)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 5000;
+    std::vector<AffineElement> points(num_points * 2 + 1);
+    std::vector<Fr> scalars(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+        scalars[i] = Fr::random_element();
+    }
+    // Scalars whose digits all carry, or that have no non-zero digits at all
+    scalars[0] = -Fr::one();
+    scalars[1] = Fr::zero();
+    scalars[2] = Fr::one();
+    scalars[3] = Fr(numeric::uint256_t(1) << 253);
+    scalar_multiplication::generate_pippenger_point_table<Curve>(&points[0], &points[0], num_points);
+
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    for (const size_t size : { size_t(1), size_t(100), size_t(1024), size_t(3001), num_points }) {
+        Element expected = scalar_multiplication::pippenger<Curve>(&scalars[0], &points[0], size, state);
+        Element result = scalar_multiplication::pippenger_signed_digit<Curve>(&scalars[0], &points[0], size, state);
+        EXPECT_EQ(result.normalize(), expected.normalize());
+        Element unsafe_result = scalar_multiplication::pippenger_unsafe<Curve>(
+            &scalars[0], &points[0], size, state, scalar_multiplication::msm_engine::signed_digit);
+        EXPECT_EQ(unsafe_result.normalize(), expected.normalize());
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, BucketAlignedThreadOffsets)
+{
+    // bucket-sorted schedule: a long run of bucket 3 in the middle
+    std::vector<uint64_t> schedule;
+    for (const uint64_t bucket : std::vector<uint64_t>{ 1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 5, 6, 7 }) {
+        schedule.push_back((static_cast<uint64_t>(schedule.size()) << 32) | bucket);
+    }
+    const size_t num_entries = schedule.size();
+    const auto offset = [&](size_t thread_index) {
+        return scalar_multiplication::get_bucket_aligned_thread_offset(&schedule[0], num_entries, 4, thread_index);
+    };
+    EXPECT_EQ(offset(0), 0UL);
+    // the nominal starts 4 and 8 land inside the bucket 3 run, and the search gives up after half a slice
+    EXPECT_EQ(offset(1), 6UL);
+    EXPECT_EQ(offset(2), 10UL);
+    // the nominal start 12 is where the run ends
+    EXPECT_EQ(offset(3), 12UL);
+    EXPECT_EQ(offset(4), num_entries);
+
+    // fewer entries than threads: everything goes to the last thread
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(scalar_multiplication::get_bucket_aligned_thread_offset(&schedule[0], 3, 4, i), 0UL);
+    }
+    EXPECT_EQ(scalar_multiplication::get_bucket_aligned_thread_offset(&schedule[0], 3, 4, 4), 3UL);
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerSkewedBuckets)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    // Most scalars are equal, so a handful of buckets hold most of the points in every round
+    constexpr size_t num_points = 3000;
+    std::vector<AffineElement> points(num_points * 2 + 1);
+    std::vector<Fr> scalars(num_points);
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+        scalars[i] = (i % 8 == 0) ? Fr::random_element() : Fr(i % 3 + 5);
+        expected += points[i] * scalars[i];
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(&points[0], &points[0], num_points);
+
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    Element result = scalar_multiplication::pippenger<Curve>(&scalars[0], &points[0], num_points, state);
+    EXPECT_EQ(result.normalize(), expected.normalize());
+    Element signed_digit_result =
+        scalar_multiplication::pippenger_signed_digit<Curve>(&scalars[0], &points[0], num_points, state);
+    EXPECT_EQ(signed_digit_result.normalize(), expected.normalize());
+}
@@ -93,6 +93,34 @@ void native_pedersen_eight_hash_bench(State& state) noexcept
 }
 BENCHMARK(native_pedersen_eight_hash_bench)->MinTime(3);
 
+constexpr size_t NUM_NATIVE_COMPRESSIONS = 1024;
+
+void native_pedersen_compress_pairs_bench(State& state) noexcept
+{
+    std::vector<grumpkin::fq> inputs(2 * NUM_NATIVE_COMPRESSIONS);
+    for (auto& input : inputs) {
+        input = grumpkin::fq::random_element();
+    }
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_NATIVE_COMPRESSIONS; ++i) {
+            DoNotOptimize(crypto::pedersen_commitment::compress_native({ inputs[2 * i], inputs[2 * i + 1] }));
+        }
+    }
+}
+BENCHMARK(native_pedersen_compress_pairs_bench)->Unit(benchmark::kMillisecond);
+
+void native_pedersen_compress_pairs_batch_bench(State& state) noexcept
+{
+    std::vector<grumpkin::fq> inputs(2 * NUM_NATIVE_COMPRESSIONS);
+    for (auto& input : inputs) {
+        input = grumpkin::fq::random_element();
+    }
+    for (auto _ : state) {
+        DoNotOptimize(crypto::pedersen_commitment::compress_native_batch(inputs, 2));
+    }
+}
+BENCHMARK(native_pedersen_compress_pairs_batch_bench)->Unit(benchmark::kMillisecond);
+
 void construct_pedersen_witnesses_bench(State& state) noexcept
 {
     for (auto _ : state) {
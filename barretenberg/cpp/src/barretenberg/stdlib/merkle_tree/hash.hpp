@@ -7,6 +7,7 @@
 #include "barretenberg/stdlib/hash/blake2s/blake2s.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <span>
 #include <vector>
 
 namespace proof_system::plonk {
@@ -23,6 +24,24 @@ inline barretenberg::fr hash_multiple_native(std::vector<barretenberg::fr> const
     return crypto::pedersen_hash::lookup::hash_multiple(inputs); // uses lookup tables
 }
 
+/**
+ * Computes hash_multiple_native over each consecutive group of `num_inputs_per_hash` inputs, hashing all of the groups
+ * together.
+ */
+inline std::vector<barretenberg::fr> hash_multiple_batch_native(std::span<const barretenberg::fr> inputs,
+                                                                size_t num_inputs_per_hash)
+{
+    return crypto::pedersen_hash::lookup::hash_multiple_batch(inputs, num_inputs_per_hash); // uses lookup tables
+}
+
+/**
+ * Computes hash_pair_native(inputs[2i], inputs[2i + 1]) for each i, hashing all of the pairs together.
+ */
+inline std::vector<barretenberg::fr> hash_pairs_native(std::span<const barretenberg::fr> inputs)
+{
+    return crypto::pedersen_hash::lookup::hash_multiple_batch(inputs, 2); // uses lookup tables
+}
+
 /**
  * Computes the root of a tree with leaves given as the vector `input`.
  *
@@ -36,11 +55,7 @@ inline barretenberg::fr compute_tree_root_native(std::vector<barretenberg::fr> c
     ASSERT(numeric::is_power_of_two(input.size()));
     auto layer = input;
     while (layer.size() > 1) {
-        std::vector<barretenberg::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::lookup::hash_multiple({ layer[i * 2], layer[i * 2 + 1] });
-        }
-        layer = std::move(next_layer);
+        layer = hash_pairs_native(layer);
     }
 
     return layer[0];
@@ -55,12 +70,8 @@ inline std::vector<barretenberg::fr> compute_tree_native(std::vector<barretenber
     auto layer = input;
     std::vector<barretenberg::fr> tree(input);
     while (layer.size() > 1) {
-        std::vector<barretenberg::fr> next_layer(layer.size() / 2);
-        for (size_t i = 0; i < next_layer.size(); ++i) {
-            next_layer[i] = crypto::pedersen_hash::lookup::hash_multiple({ layer[i * 2], layer[i * 2 + 1] });
-            tree.push_back(next_layer[i]);
-        }
-        layer = std::move(next_layer);
+        layer = hash_pairs_native(layer);
+        tree.insert(tree.end(), layer.begin(), layer.end());
     }
 
     return tree;
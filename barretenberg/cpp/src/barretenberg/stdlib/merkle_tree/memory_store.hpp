@@ -78,6 +78,22 @@ class MemoryStore {
         deletes_.clear();
     }
 
+    // The keys that `get` currently finds
+    std::set<std::string> get_keys() const
+    {
+        std::set<std::string> keys;
+        for (auto const& [key, value] : store_) {
+            keys.insert(key);
+        }
+        for (auto const& [key, value] : puts_) {
+            keys.insert(key);
+        }
+        for (auto const& key : deletes_) {
+            keys.erase(key);
+        }
+        return keys;
+    }
+
   private:
     std::string to_string(std::vector<uint8_t> const& input) { return std::string((char*)input.data(), input.size()); }
 
@@ -75,6 +75,82 @@ fr MemoryTree::update_element(size_t index, fr const& value)
     return root_;
 }
 
+/**
+ * Sets the leaves at indices [start_index, start_index + values.size()) to `values`, recomputing the nodes above them
+ * one level at a time. The children of the updated nodes of a level are contiguous in hashes_, so each level is hashed
+ * as a single batch.
+ */
+fr MemoryTree::update_elements(size_t start_index, std::span<const fr> values)
+{
+    ASSERT(!values.empty() && start_index + values.size() <= total_size_);
+    std::copy(values.begin(), values.end(), hashes_.begin() + static_cast<ptrdiff_t>(start_index));
+
+    size_t offset = 0;
+    size_t layer_size = total_size_;
+    size_t first = start_index;
+    size_t last = start_index + values.size() - 1;
+    for (size_t i = 0; i < depth_; ++i) {
+        const size_t first_child = first & ~1UL;
+        const size_t last_child = last | 1UL;
+        auto parents = hash_pairs_native(
+            std::span<const fr>(hashes_).subspan(offset + first_child, last_child - first_child + 1));
+        offset += layer_size;
+        layer_size >>= 1;
+        first >>= 1;
+        last >>= 1;
+        if (i + 1 < depth_) {
+            std::copy(parents.begin(), parents.end(), hashes_.begin() + static_cast<ptrdiff_t>(offset + first));
+        } else {
+            root_ = parents[0];
+        }
+    }
+    return root_;
+}
+
+/**
+ * Sets the leaves at the strictly increasing `indices` to `values`. As above, the tree is recomputed one level at a
+ * time, hashing together the parents of all of the nodes updated on the level below; a parent shared by several
+ * updated nodes is only computed once.
+ */
+fr MemoryTree::update_elements(std::span<const size_t> indices, std::span<const fr> values)
+{
+    ASSERT(!indices.empty() && indices.size() == values.size() && indices.back() < total_size_);
+    for (size_t i = 0; i < indices.size(); ++i) {
+        ASSERT(i == 0 || indices[i - 1] < indices[i]);
+        hashes_[indices[i]] = values[i];
+    }
+
+    std::vector<size_t> updated(indices.begin(), indices.end());
+    std::vector<fr> children;
+    size_t offset = 0;
+    size_t layer_size = total_size_;
+    for (size_t i = 0; i < depth_; ++i) {
+        // Sorted indices sharing a parent are adjacent, so dropping repeated parents leaves them sorted and unique.
+        size_t num_parents = 0;
+        children.clear();
+        for (const size_t index : updated) {
+            const size_t parent = index >> 1;
+            if (num_parents == 0 || updated[num_parents - 1] != parent) {
+                updated[num_parents++] = parent;
+                children.push_back(hashes_[offset + 2 * parent]);
+                children.push_back(hashes_[offset + 2 * parent + 1]);
+            }
+        }
+        updated.resize(num_parents);
+        auto parents = hash_pairs_native(children);
+        offset += layer_size;
+        layer_size >>= 1;
+        if (i + 1 < depth_) {
+            for (size_t j = 0; j < num_parents; ++j) {
+                hashes_[offset + updated[j]] = parents[j];
+            }
+        } else {
+            root_ = parents[0];
+        }
+    }
+    return root_;
+}
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "hash_path.hpp"
+#include <span>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -34,6 +35,10 @@ class MemoryTree {
 
     fr update_element(size_t index, fr const& value);
 
+    fr update_elements(size_t start_index, std::span<const fr> values);
+
+    fr update_elements(std::span<const size_t> indices, std::span<const fr> values);
+
     fr root() const { return root_; }
 
   public:
@@ -78,3 +78,20 @@ TEST(stdlib_merkle_tree, test_memory_store_sibling_path)
     EXPECT_EQ(db.get_sibling_path(3), expected03);
     EXPECT_EQ(db.root(), root);
 }
+
+TEST(stdlib_merkle_tree, test_memory_store_update_elements)
+{
+    MemoryTree batch_db(6);
+    MemoryTree db(6);
+    batch_db.update_element(4, VALUES[3]);
+    db.update_element(4, VALUES[3]);
+
+    std::vector<fr> values(35);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = fr(i + 5);
+        db.update_element(5 + i, values[i]);
+    }
+    EXPECT_EQ(batch_db.update_elements(5, values), db.root());
+    EXPECT_EQ(batch_db.root(), db.root());
+    EXPECT_EQ(batch_db.hashes_, db.hashes_);
+}
@@ -2,6 +2,7 @@
 #include "barretenberg/numeric/random/engine.hpp"
 #include "hash.hpp"
 #include "memory_store.hpp"
+#include "memory_tree.hpp"
 #include <benchmark/benchmark.h>
 
 using namespace benchmark;
@@ -30,6 +31,24 @@ void hash(State& state) noexcept
 }
 BENCHMARK(hash)->MinTime(5);
 
+void hash_pairs(State& state) noexcept
+{
+    for (auto _ : state) {
+        for (size_t i = 0; i < (size_t)state.range(0); i += 2) {
+            DoNotOptimize(hash_pair_native(VALUES[i], VALUES[i + 1]));
+        }
+    }
+}
+BENCHMARK(hash_pairs)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(256, MAX);
+
+void hash_pairs_batch(State& state) noexcept
+{
+    for (auto _ : state) {
+        DoNotOptimize(hash_pairs_native(std::span(VALUES).subspan(0, (size_t)state.range(0))));
+    }
+}
+BENCHMARK(hash_pairs_batch)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(256, MAX);
+
 void update_first_element(State& state) noexcept
 {
     MemoryStore store;
@@ -55,6 +74,40 @@ void update_elements(State& state) noexcept
 }
 BENCHMARK(update_elements)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(256, MAX);
 
+void update_elements_batch(State& state) noexcept
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        MemoryStore store;
+        MerkleTree<MemoryStore> db(store, DEPTH);
+        state.ResumeTiming();
+        db.update_elements(0, std::span(VALUES).subspan(0, (size_t)state.range(0)));
+    }
+}
+BENCHMARK(update_elements_batch)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(256, MAX);
+
+constexpr size_t MEMORY_TREE_DEPTH = 20;
+
+void memory_tree_update_elements(State& state) noexcept
+{
+    MemoryTree db(MEMORY_TREE_DEPTH);
+    for (auto _ : state) {
+        for (size_t i = 0; i < (size_t)state.range(0); ++i) {
+            db.update_element(i, VALUES[i]);
+        }
+    }
+}
+BENCHMARK(memory_tree_update_elements)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(256, MAX);
+
+void memory_tree_update_elements_batch(State& state) noexcept
+{
+    MemoryTree db(MEMORY_TREE_DEPTH);
+    for (auto _ : state) {
+        db.update_elements(0, std::span(VALUES).subspan(0, (size_t)state.range(0)));
+    }
+}
+BENCHMARK(memory_tree_update_elements_batch)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(256, MAX);
+
 void update_random_elements(State& state) noexcept
 {
     for (auto _ : state) {
@@ -138,8 +138,16 @@ template <typename Store> fr_hash_path MerkleTree<Store>::get_hash_path(index_t
 }
 
 template <typename Store> fr_sibling_path MerkleTree<Store>::get_sibling_path(index_t index)
+{
+    std::optional<unstored_subtree> unstored_sibling;
+    return get_sibling_path(index, unstored_sibling);
+}
+
+template <typename Store>
+fr_sibling_path MerkleTree<Store>::get_sibling_path(index_t index, std::optional<unstored_subtree>& unstored_sibling)
 {
     fr_sibling_path path(depth_);
+    unstored_sibling.reset();
 
     std::vector<uint8_t> data;
     bool status = store_.get(root().to_buffer(), data);
@@ -188,6 +196,7 @@ template <typename Store> fr_sibling_path MerkleTree<Store>::get_sibling_path(in
 
                 // Insert the only non-zero sibling at the common height.
                 path[common_height] = compute_zero_path_hash(common_height, element_index, current);
+                unstored_sibling = { common_height, numeric::keep_n_lsb(element_index, common_height), current };
             }
             break;
         }
@@ -216,6 +225,110 @@ template <typename Store> fr MerkleTree<Store>::update_element(index_t index, fr
     return r;
 }
 
+/**
+ * Sets the leaves at indices [start_index, start_index + values.size()) to `values`.
+ *
+ * Rather than walking the path to the root once per leaf, the nodes above the updated leaves are recomputed one level
+ * at a time, with each level hashed as a single batch. A level only needs the existing siblings at its two ends, and
+ * these are read from the sibling paths of the first and last updated leaves before anything is written. The new nodes
+ * are stored as regular nodes. As in `update_element`, the nodes they replace are removed, apart from the old root.
+ */
+template <typename Store> fr MerkleTree<Store>::update_elements(index_t start_index, std::span<const fr> values)
+{
+    ASSERT(!values.empty());
+    const index_t last_index = start_index + index_t(values.size() - 1);
+    std::optional<unstored_subtree> first_unstored_sibling;
+    std::optional<unstored_subtree> last_unstored_sibling;
+    const auto first_siblings = get_sibling_path(start_index, first_unstored_sibling);
+    const auto last_siblings = get_sibling_path(last_index, last_unstored_sibling);
+
+    // Every stored node above an updated leaf is replaced, including any stump that gets split. They are removed
+    // before the new nodes are stored, so a node that comes out unchanged is simply stored again.
+    const fr old_root = root();
+    std::vector<fr> replaced_nodes;
+    get_nodes_above_range(old_root, depth_, start_index, last_index + 1, replaced_nodes);
+    for (auto const& node : replaced_nodes) {
+        if (!(node == old_root)) {
+            remove(node);
+        }
+    }
+
+    using serialize::write;
+    for (size_t i = 0; i < values.size(); ++i) {
+        std::vector<uint8_t> leaf_key;
+        write(leaf_key, tree_id_);
+        write(leaf_key, start_index + index_t(i));
+        store_.put(leaf_key, to_buffer(values[i]));
+    }
+
+    // An existing sibling that is an unstored subtree is about to become the child of a regular node, so it needs a
+    // node of its own.
+    auto add_sibling = [&](std::vector<fr>& children,
+                           fr const& sibling,
+                           std::optional<unstored_subtree> const& unstored_sibling,
+                           size_t height) {
+        if (unstored_sibling.has_value() && unstored_sibling->height == height && height > 0) {
+            put_stump(sibling, unstored_sibling->index, unstored_sibling->value);
+        }
+        children.push_back(sibling);
+    };
+
+    std::vector<fr> layer(values.begin(), values.end());
+    index_t first = start_index;
+    index_t last = last_index;
+    for (size_t height = 0; height < depth_; ++height) {
+        std::vector<fr> children;
+        children.reserve(layer.size() + 2);
+        if (bit_set(first, 0)) {
+            add_sibling(children, first_siblings[height], first_unstored_sibling, height);
+        }
+        children.insert(children.end(), layer.begin(), layer.end());
+        if (!bit_set(last, 0)) {
+            add_sibling(children, last_siblings[height], last_unstored_sibling, height);
+        }
+
+        layer = hash_pairs_native(children);
+        for (size_t i = 0; i < layer.size(); ++i) {
+            put(layer[i], children[2 * i], children[2 * i + 1]);
+        }
+        first >>= 1;
+        last >>= 1;
+    }
+    auto r = layer[0];
+
+    std::vector<uint8_t> meta_key = { tree_id_ };
+    std::vector<uint8_t> meta_buf;
+    write(meta_buf, r);
+    write(meta_buf, last_index + 1);
+    store_.put(meta_key, meta_buf);
+
+    return r;
+}
+
+template <typename Store>
+void MerkleTree<Store>::get_nodes_above_range(
+    fr const& root, size_t height, index_t first, index_t last, std::vector<fr>& nodes)
+{
+    std::vector<uint8_t> data;
+    if (height == 0 || !store_.get(root.to_buffer(), data)) {
+        // A leaf, or an empty subtree
+        return;
+    }
+    nodes.push_back(root);
+    if (data.size() != REGULAR_NODE_SIZE) {
+        // A stump has no stored nodes below it
+        return;
+    }
+    const index_t half = index_t(1) << (height - 1);
+    if (first < half) {
+        get_nodes_above_range(from_buffer<fr>(data, 0), height - 1, first, std::min(last, half), nodes);
+    }
+    if (last > half) {
+        get_nodes_above_range(
+            from_buffer<fr>(data, 32), height - 1, std::max(first, half) - half, last - half, nodes);
+    }
+}
+
 template <typename Store> fr MerkleTree<Store>::binary_put(index_t a_index, fr const& a, fr const& b, size_t height)
 {
     bool a_is_right = bit_set(a_index, height - 1);
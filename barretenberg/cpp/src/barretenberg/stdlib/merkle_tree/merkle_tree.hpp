@@ -1,6 +1,8 @@
 #pragma once
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "hash_path.hpp"
+#include <optional>
+#include <span>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -25,6 +27,8 @@ template <typename Store> class MerkleTree {
 
     fr update_element(index_t index, fr const& value);
 
+    fr update_elements(index_t start_index, std::span<const fr> values);
+
     fr root() const;
 
     size_t depth() const { return depth_; }
@@ -32,8 +36,23 @@ template <typename Store> class MerkleTree {
     index_t size() const;
 
   protected:
+    /**
+     * A subtree of the current tree that holds a single non-empty leaf, but is not stored as a node because it lies
+     * below a stump.
+     */
+    struct unstored_subtree {
+        size_t height;
+        index_t index;
+        fr value;
+    };
+
     void load_metadata();
 
+    /**
+     * As get_sibling_path, additionally returning the sibling that is an unstored subtree, if there is one.
+     */
+    fr_sibling_path get_sibling_path(index_t index, std::optional<unstored_subtree>& unstored_sibling);
+
     /**
      * Computes the root hash of a tree of `height`, that is empty other than `value` at `index`.
      *
@@ -69,6 +88,17 @@ template <typename Store> class MerkleTree {
     fr fork_stump(
         fr const& value1, index_t index1, fr const& value2, index_t index2, size_t height, size_t stump_height);
 
+    /**
+     * Collects the stored nodes (regular nodes and stumps) of the subtree under `root` that lie above any of the leaves
+     * in [first, last), including `root` itself.
+     *
+     * @param root: the root of the subtree
+     * @param height: the height of the subtree
+     * @param first, last: the range of leaves, relative to the subtree's first leaf
+     * @param nodes: the collected nodes are appended here
+     */
+    void get_nodes_above_range(fr const& root, size_t height, index_t first, index_t last, std::vector<fr>& nodes);
+
     /**
      * Stores a parent node and child nodes in the database as [key : (left, right)].
      *
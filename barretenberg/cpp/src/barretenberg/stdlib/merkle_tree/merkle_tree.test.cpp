@@ -184,4 +184,108 @@ TEST(stdlib_merkle_tree, test_get_sibling_path_layers)
         EXPECT_NE(before[2], after[2]);
     }
 }
-} // namespace proof_system::test_stdlib_merkle_tree
\ No newline at end of file
+TEST(stdlib_merkle_tree, test_update_elements_matches_update_element)
+{
+    constexpr size_t depth = 10;
+
+    // Existing leaves: stumps on either side of the updated range, and a subtree inside it.
+    const std::vector<size_t> existing = { 3, 100, 101, 102, 700, 1000 };
+    const size_t start_index = 90;
+    const size_t num_values = 500;
+
+    MemoryStore batch_store;
+    MerkleTree batch_db(batch_store, depth);
+    MemoryStore store;
+    MerkleTree db(store, depth);
+    for (auto index : existing) {
+        batch_db.update_element(index, VALUES[index]);
+        db.update_element(index, VALUES[index]);
+    }
+
+    std::vector<fr> values(num_values);
+    for (size_t i = 0; i < num_values; ++i) {
+        values[i] = VALUES[(i * 7) % VALUES.size()];
+        db.update_element(start_index + i, values[i]);
+    }
+    EXPECT_EQ(batch_db.update_elements(start_index, values), db.root());
+    EXPECT_EQ(batch_db.root(), db.root());
+    EXPECT_EQ(batch_db.size(), db.size());
+
+    for (auto index : { 0UL, 3UL, 89UL, 90UL, 101UL, 589UL, 590UL, 700UL, 1000UL, 1023UL }) {
+        EXPECT_EQ(batch_db.get_hash_path(index), db.get_hash_path(index));
+        EXPECT_EQ(batch_db.get_sibling_path(index), db.get_sibling_path(index));
+    }
+
+    // The tree remains consistent for later single updates.
+    for (auto index : { 2UL, 95UL, 600UL, 701UL }) {
+        batch_db.update_element(index, VALUES[index]);
+        db.update_element(index, VALUES[index]);
+        EXPECT_EQ(batch_db.get_hash_path(index), db.get_hash_path(index));
+    }
+    EXPECT_EQ(batch_db.root(), db.root());
+}
+TEST(stdlib_merkle_tree, test_update_elements_below_stump)
+{
+    // With a single leaf in the tree, the subtrees that hold it below the root have no nodes of their own.
+    for (size_t existing : { 3UL, 12UL }) {
+        MemoryStore batch_store;
+        MerkleTree batch_db(batch_store, 8);
+        MemoryStore store;
+        MerkleTree db(store, 8);
+        batch_db.update_element(existing, VALUES[1]);
+        db.update_element(existing, VALUES[1]);
+
+        std::vector<fr> values = { VALUES[5], VALUES[6], VALUES[7] };
+        for (size_t i = 0; i < values.size(); ++i) {
+            db.update_element(5 + i, values[i]);
+        }
+        EXPECT_EQ(batch_db.update_elements(5, values), db.root());
+        for (size_t index = 0; index < 16; ++index) {
+            EXPECT_EQ(batch_db.get_hash_path(index), db.get_hash_path(index));
+        }
+    }
+}
+TEST(stdlib_merkle_tree, test_update_elements_removes_replaced_nodes)
+{
+    constexpr size_t depth = 10;
+
+    // Overwriting a full subtree, and splitting the stump of a tree that holds a single leaf
+    struct update {
+        std::vector<size_t> existing;
+        size_t start_index;
+        size_t num_values;
+    };
+    std::vector<update> updates = { { std::vector<size_t>(32), 8, 16 }, { { 13 }, 0, 4 } };
+    std::iota(updates[0].existing.begin(), updates[0].existing.end(), 0);
+
+    for (auto const& [existing, start_index, num_values] : updates) {
+        MemoryStore batch_store;
+        MerkleTree batch_db(batch_store, depth);
+        MemoryStore store;
+        MerkleTree db(store, depth);
+        for (auto index : existing) {
+            batch_db.update_element(index, VALUES[index]);
+            db.update_element(index, VALUES[index]);
+        }
+
+        // The single updates also leave behind the root of each tree along the way, which the batch never builds
+        std::vector<fr> values(num_values);
+        std::set<std::string> intermediate_roots;
+        for (size_t i = 0; i < num_values; ++i) {
+            values[i] = VALUES[start_index + i + 100];
+            if (i > 0) {
+                auto root = db.root().to_buffer();
+                intermediate_roots.insert(std::string(root.begin(), root.end()));
+            }
+            db.update_element(start_index + i, values[i]);
+        }
+        EXPECT_EQ(batch_db.update_elements(start_index, values), db.root());
+
+        auto expected_keys = store.get_keys();
+        for (auto const& root : intermediate_roots) {
+            expected_keys.erase(root);
+        }
+        EXPECT_EQ(batch_store.get_keys(), expected_keys);
+    }
+}
+} // namespace proof_system::test_stdlib_merkle_tree
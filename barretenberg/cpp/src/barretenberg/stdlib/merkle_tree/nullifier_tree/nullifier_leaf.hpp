@@ -1,6 +1,8 @@
 #pragma once
+#include "../hash.hpp"
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
+#include <map>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -113,6 +115,102 @@ inline std::pair<size_t, bool> find_closest_leaf(std::vector<WrappedNullifierLea
     return std::make_pair(static_cast<size_t>(it - diff.begin()), repeated);
 }
 
+/**
+ * @brief Map from the values of the non-empty leaves to their indices, kept sorted so that the low leaf of a value can
+ * be found in logarithmic time
+ */
+using leaf_value_index = std::map<uint256_t, size_t>;
+
+/**
+ * @brief Same result as find_closest_leaf, but using the sorted index of leaf values rather than a scan over the leaves
+ */
+inline std::pair<size_t, bool> find_low_leaf(leaf_value_index const& sorted_values, fr const& new_value)
+{
+    auto new_value_ = uint256_t(new_value);
+    auto it = sorted_values.lower_bound(new_value_);
+    if (it != sorted_values.end() && it->first == new_value_) {
+        return std::make_pair(it->second, true);
+    }
+    // The initial zero leaf is always present, so any other value has a lower leaf
+    ASSERT(it != sorted_values.begin());
+    return std::make_pair(std::prev(it)->second, false);
+}
+
+/**
+ * @brief Inserts `values` into the leaves, with the same result as inserting them one at a time
+ *
+ * @details New leaves are appended in the order of `values`, skipping values that are already present; a zero value
+ * appends an empty leaf. The new values are then visited in sorted order, so that those sharing a low leaf form a run:
+ * the low leaf points at the first value of the run, each new leaf points at the next one, and the last one takes over
+ * the old pointer of the low leaf. This links a whole batch in a single pass over the sorted values.
+ *
+ * @return The indices of the pre-existing leaves that were updated, in increasing order
+ */
+inline std::vector<size_t> insert_leaves(std::vector<WrappedNullifierLeaf>& leaves,
+                                         leaf_value_index& sorted_values,
+                                         std::vector<fr> const& values)
+{
+    leaf_value_index new_values;
+    for (const auto& value : values) {
+        if (value == 0) {
+            leaves.push_back(WrappedNullifierLeaf::zero());
+            continue;
+        }
+        const auto value_ = uint256_t(value);
+        if (!sorted_values.contains(value_) && new_values.emplace(value_, leaves.size()).second) {
+            leaves.push_back(WrappedNullifierLeaf::zero());
+        }
+    }
+
+    std::vector<size_t> low_leaves;
+    auto low = sorted_values.end();
+    size_t previous = 0;
+    for (const auto& [value, index] : new_values) {
+        auto value_low = std::prev(sorted_values.lower_bound(value));
+        if (value_low != low) {
+            low = value_low;
+            previous = low->second;
+            low_leaves.push_back(previous);
+        }
+        nullifier_leaf previous_leaf = leaves[previous].unwrap();
+        leaves[index].set(
+            { .value = fr(value), .nextIndex = previous_leaf.nextIndex, .nextValue = previous_leaf.nextValue });
+        previous_leaf.nextIndex = index;
+        previous_leaf.nextValue = fr(value);
+        leaves[previous].set(previous_leaf);
+        previous = index;
+    }
+    sorted_values.merge(new_values);
+
+    std::sort(low_leaves.begin(), low_leaves.end());
+    return low_leaves;
+}
+
+/**
+ * @brief Hashes of the leaves at `indices`, with all of the non-empty leaves hashed together in one batch
+ */
+inline std::vector<fr> hash_leaves(std::vector<WrappedNullifierLeaf> const& leaves, std::span<const size_t> indices)
+{
+    std::vector<fr> inputs;
+    inputs.reserve(3 * indices.size());
+    for (const size_t index : indices) {
+        if (leaves[index].has_value()) {
+            const nullifier_leaf leaf = leaves[index].unwrap();
+            inputs.insert(inputs.end(), { leaf.value, leaf.nextIndex, leaf.nextValue });
+        }
+    }
+    std::vector<fr> leaf_hashes;
+    if (!inputs.empty()) {
+        leaf_hashes = hash_multiple_batch_native(inputs, 3);
+    }
+
+    std::vector<fr> hashes(indices.size());
+    for (size_t i = 0, j = 0; i < indices.size(); ++i) {
+        hashes[i] = leaves[indices[i]].has_value() ? leaf_hashes[j++] : fr::zero();
+    }
+    return hashes;
+}
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
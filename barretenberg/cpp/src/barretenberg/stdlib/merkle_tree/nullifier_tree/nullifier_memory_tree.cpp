@@ -25,51 +25,31 @@ NullifierMemoryTree::NullifierMemoryTree(size_t depth)
     // Insert the initial leaf at index 0
     auto initial_leaf = WrappedNullifierLeaf(nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
     leaves_.push_back(initial_leaf);
+    sorted_values_.emplace(0, 0);
     root_ = update_element(0, initial_leaf.hash());
 }
 
 fr NullifierMemoryTree::update_element(fr const& value)
 {
-    // Find the leaf with the value closest and less than `value`
+    return update_elements({ value });
+}
 
-    // If value is 0 we simply append 0 a null NullifierLeaf to the tree
-    if (value == 0) {
-        auto zero_leaf = WrappedNullifierLeaf::zero();
-        leaves_.push_back(zero_leaf);
-        return update_element(leaves_.size() - 1, zero_leaf.hash());
+/**
+ * Inserts `values` with the same result as calling update_element on each of them in turn. The low leaves are found
+ * through the sorted index of leaf values rather than by scanning the leaves, and the updated leaves are hashed and
+ * written to the tree in one batch, so the cost grows with the number of values instead of with their square.
+ */
+fr NullifierMemoryTree::update_elements(std::vector<fr> const& values)
+{
+    const size_t start_index = leaves_.size();
+    auto updated = insert_leaves(leaves_, sorted_values_, values);
+    for (size_t i = start_index; i < leaves_.size(); ++i) {
+        updated.push_back(i);
     }
-
-    size_t current;
-    bool is_already_present;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves_, value);
-
-    nullifier_leaf current_leaf = leaves_[current].unwrap();
-    nullifier_leaf new_leaf = { .value = value,
-                                .nextIndex = current_leaf.nextIndex,
-                                .nextValue = current_leaf.nextValue };
-
-    if (!is_already_present) {
-        // Update the current leaf to point it to the new leaf
-        current_leaf.nextIndex = leaves_.size();
-        current_leaf.nextValue = value;
-
-        leaves_[current].set(current_leaf);
-
-        // Insert the new leaf with (nextIndex, nextValue) of the current leaf
-        leaves_.push_back(new_leaf);
+    if (updated.empty()) {
+        return root_;
     }
-
-    // Update the old leaf in the tree
-    auto old_leaf_hash = current_leaf.hash();
-    size_t old_leaf_index = current;
-    auto root = update_element(old_leaf_index, old_leaf_hash);
-
-    // Insert the new leaf in the tree
-    auto new_leaf_hash = new_leaf.hash();
-    size_t new_leaf_index = is_already_present ? old_leaf_index : leaves_.size() - 1;
-    root = update_element(new_leaf_index, new_leaf_hash);
-
-    return root;
+    return update_elements(updated, hash_leaves(leaves_, updated));
 }
 
 } // namespace merkle_tree
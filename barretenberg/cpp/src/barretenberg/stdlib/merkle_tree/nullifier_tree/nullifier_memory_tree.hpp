@@ -75,9 +75,17 @@ class NullifierMemoryTree : public MemoryTree {
     using MemoryTree::get_hash_path;
     using MemoryTree::root;
     using MemoryTree::update_element;
+    using MemoryTree::update_elements;
 
     fr update_element(fr const& value);
 
+    fr update_elements(std::vector<fr> const& values);
+
+    std::pair<size_t, bool> find_low_leaf(fr const& value) const
+    {
+        return merkle_tree::find_low_leaf(sorted_values_, value);
+    }
+
     const std::vector<barretenberg::fr>& get_hashes() { return hashes_; }
     const WrappedNullifierLeaf get_leaf(size_t index)
     {
@@ -91,6 +99,7 @@ class NullifierMemoryTree : public MemoryTree {
     using MemoryTree::root_;
     using MemoryTree::total_size_;
     std::vector<WrappedNullifierLeaf> leaves_;
+    leaf_value_index sorted_values_;
 };
 
 } // namespace merkle_tree
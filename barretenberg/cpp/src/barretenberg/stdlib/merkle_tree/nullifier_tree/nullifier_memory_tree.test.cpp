@@ -368,4 +368,38 @@ TEST(crypto_nullifier_tree, test_nullifier_tree)
     // Merkle proof at `index` proves non-membership of `new_member`
     auto hash_path = tree.get_hash_path(index);
     EXPECT_TRUE(check_hash_path(tree.root(), hash_path, leaves[index].unwrap(), index));
-}
\ No newline at end of file
+}
+TEST(crypto_nullifier_tree, test_nullifier_memory_update_elements)
+{
+    constexpr size_t depth = 8;
+    NullifierMemoryTree tree(depth);
+    NullifierMemoryTree batch_tree(depth);
+
+    // Batches mixing fresh values with zeros, values already in the tree and repeats within the batch
+    std::vector<fr> inserted;
+    for (size_t batch_size : { 1UL, 7UL, 32UL, 60UL }) {
+        std::vector<fr> values;
+        for (size_t i = 0; i < batch_size; i++) {
+            values.push_back(fr::random_element());
+        }
+        values.push_back(0);
+        values.push_back(values[0]);
+        if (!inserted.empty()) {
+            values.push_back(inserted.back());
+        }
+        inserted.insert(inserted.end(), values.begin(), values.end());
+
+        for (const auto& value : values) {
+            tree.update_element(value);
+        }
+        EXPECT_EQ(batch_tree.update_elements(values), tree.root());
+        EXPECT_EQ(batch_tree.get_leaves(), tree.get_leaves());
+        EXPECT_EQ(batch_tree.get_hashes(), tree.get_hashes());
+    }
+
+    // The sorted index agrees with a scan over the leaves
+    for (size_t i = 0; i < 16; i++) {
+        fr value = (i % 2 == 0) ? fr::random_element() : inserted[i];
+        EXPECT_EQ(batch_tree.find_low_leaf(value), find_closest_leaf(batch_tree.get_leaves(), value));
+    }
+}
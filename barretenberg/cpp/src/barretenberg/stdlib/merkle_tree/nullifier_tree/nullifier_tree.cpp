@@ -7,6 +7,7 @@
 #include "barretenberg/numeric/bitop/keep_n_lsb.hpp"
 #include "barretenberg/numeric/uint128/uint128.hpp"
 #include <iostream>
+#include <numeric>
 #include <sstream>
 
 namespace proof_system::plonk {
@@ -32,6 +33,7 @@ NullifierTree<Store>::NullifierTree(Store& store, size_t depth, uint8_t tree_id)
     WrappedNullifierLeaf initial_leaf =
         WrappedNullifierLeaf(nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
     leaves.push_back(initial_leaf);
+    sorted_values.emplace(0, 0);
     update_element(0, initial_leaf.hash());
 
     // Create the zero hashes for the tree
@@ -51,35 +53,34 @@ template <typename Store> NullifierTree<Store>::~NullifierTree() {}
 
 template <typename Store> fr NullifierTree<Store>::update_element(fr const& value)
 {
-    // Find the leaf with the value closest and less than `value`
-    size_t current;
-    bool is_already_present;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves, value);
-
-    nullifier_leaf current_leaf = leaves[current].unwrap();
-    WrappedNullifierLeaf new_leaf = WrappedNullifierLeaf(
-        { .value = value, .nextIndex = current_leaf.nextIndex, .nextValue = current_leaf.nextValue });
-    if (!is_already_present) {
-        // Update the current leaf to point it to the new leaf
-        current_leaf.nextIndex = leaves.size();
-        current_leaf.nextValue = value;
-
-        leaves[current].set(current_leaf);
+    return update_elements({ value });
+}
 
-        // Insert the new leaf with (nextIndex, nextValue) of the current leaf
-        leaves.push_back(new_leaf);
+/**
+ * Inserts `values` with the same result as calling update_element on each of them in turn, where a zero value is
+ * treated as already present. The low leaves are found through the sorted index of leaf values, and the new leaves,
+ * which are contiguous, are written with a single batched update once the low leaves have been updated.
+ */
+template <typename Store> fr NullifierTree<Store>::update_elements(std::vector<fr> const& values)
+{
+    std::vector<fr> non_zero_values;
+    std::copy_if(values.begin(), values.end(), std::back_inserter(non_zero_values), [](fr const& value) {
+        return value != 0;
+    });
+
+    const size_t start_index = leaves.size();
+    const auto low_leaves = insert_leaves(leaves, sorted_values, non_zero_values);
+    const auto low_leaf_hashes = hash_leaves(leaves, low_leaves);
+    auto r = root();
+    for (size_t i = 0; i < low_leaves.size(); ++i) {
+        r = update_element(low_leaves[i], low_leaf_hashes[i]);
     }
 
-    // Update the old leaf in the tree
-    auto old_leaf_hash = leaves[current].hash();
-    index_t old_leaf_index = current;
-    auto r = update_element(old_leaf_index, old_leaf_hash);
-
-    // Insert the new leaf in the tree
-    auto new_leaf_hash = new_leaf.hash();
-    index_t new_leaf_index = is_already_present ? old_leaf_index : leaves.size() - 1;
-    r = update_element(new_leaf_index, new_leaf_hash);
-
+    if (leaves.size() > start_index) {
+        std::vector<size_t> new_leaves(leaves.size() - start_index);
+        std::iota(new_leaves.begin(), new_leaves.end(), start_index);
+        r = update_elements(start_index, hash_leaves(leaves, new_leaves));
+    }
     return r;
 }
 
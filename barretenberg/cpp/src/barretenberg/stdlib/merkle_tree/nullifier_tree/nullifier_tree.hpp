@@ -25,8 +25,11 @@ template <typename Store> class NullifierTree : public MerkleTree<Store> {
 
     fr update_element(fr const& value);
 
+    fr update_elements(std::vector<fr> const& values);
+
   private:
     using MerkleTree<Store>::update_element;
+    using MerkleTree<Store>::update_elements;
     using MerkleTree<Store>::get_element;
     using MerkleTree<Store>::compute_zero_path_hash;
 
@@ -36,6 +39,7 @@ template <typename Store> class NullifierTree : public MerkleTree<Store> {
     using MerkleTree<Store>::depth_;
     using MerkleTree<Store>::tree_id_;
     std::vector<WrappedNullifierLeaf> leaves;
+    leaf_value_index sorted_values;
 };
 
 extern template class NullifierTree<MemoryStore>;
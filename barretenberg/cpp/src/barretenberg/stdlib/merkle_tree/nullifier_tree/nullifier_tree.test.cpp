@@ -137,4 +137,25 @@ TEST(stdlib_nullifier_tree, test_get_hash_path_layers)
         EXPECT_EQ(before[1], after[1]);
         EXPECT_NE(before[2], after[2]);
     }
-}
\ No newline at end of file
+}
+TEST(stdlib_nullifier_tree, test_update_elements_matches_update_element)
+{
+    constexpr size_t depth = 10;
+    NullifierMemoryTree memdb(depth);
+
+    MemoryStore store;
+    NullifierTree db(store, depth);
+
+    std::vector<fr> values(VALUES.begin(), VALUES.begin() + 128);
+    values.push_back(VALUES[3]);
+
+    for (const auto& value : values) {
+        memdb.update_element(value);
+    }
+    EXPECT_EQ(db.update_elements(values), memdb.root());
+    EXPECT_EQ(db.size(), 129ULL);
+
+    for (size_t i = 0; i < 129; ++i) {
+        EXPECT_EQ(db.get_hash_path(i), memdb.get_hash_path(i));
+    }
+}
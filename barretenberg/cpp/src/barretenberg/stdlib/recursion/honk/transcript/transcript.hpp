@@ -72,7 +72,7 @@ template <typename Builder> class Transcript {
      * @param label Name of challenge
      * @return field_ct Challenge
      */
-    field_ct get_challenge(const std::string& label)
+    field_ct get_challenge(std::string_view label)
     {
         // Compute the indicated challenge from the native transcript
         auto native_challenge = native_transcript.get_challenge(label);
@@ -82,6 +82,15 @@ template <typename Builder> class Transcript {
         return field_ct::from_witness(builder, native_challenge);
     }
 
+    /**
+     * @brief Compute the single challenge labelled `label` followed by `label_index`
+     */
+    field_ct get_challenge(std::string_view label, size_t label_index)
+    {
+        auto native_challenge = native_transcript.get_challenge(label, label_index);
+        return field_ct::from_witness(builder, native_challenge);
+    }
+
     /**
      * @brief Extract a native element from the transcript and return a corresponding stdlib type
      *
@@ -89,7 +98,7 @@ template <typename Builder> class Transcript {
      * @param label Name of the element
      * @return The corresponding element of appropriate stdlib type
      */
-    template <class T> auto receive_from_prover(const std::string& label)
+    template <class T> auto receive_from_prover(std::string_view label)
     {
         // Get native type corresponding to input type
         using NativeType = typename StdlibTypes::template NativeType<T>::type;
@@ -100,5 +109,15 @@ template <typename Builder> class Transcript {
         // Return the corresponding stdlib type
         return StdlibTypes::from_witness(builder, element);
     }
+
+    /**
+     * @brief Extract a native element labelled `label` followed by `label_index`
+     */
+    template <class T> auto receive_from_prover(std::string_view label, size_t label_index)
+    {
+        using NativeType = typename StdlibTypes::template NativeType<T>::type;
+        NativeType element = native_transcript.template receive_from_prover<NativeType>(label, label_index);
+        return StdlibTypes::from_witness(builder, element);
+    }
 };
 } // namespace proof_system::plonk::stdlib::recursion::honk
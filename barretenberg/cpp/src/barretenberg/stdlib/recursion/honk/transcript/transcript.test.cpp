@@ -92,6 +92,7 @@ template <class Flavor, size_t LENGTH> void perform_mock_verifier_transcript_ope
  */
 TEST(RecursiveHonkTranscript, InterfacesMatch)
 {
+    proof_system::honk::TranscriptManifest::ScopedRecording record_manifests;
     Builder builder;
 
     constexpr size_t LENGTH = 8; // arbitrary length of Univariate to be serialized
@@ -87,7 +87,16 @@ template <typename BuilderType> class RecursiveVerifierTest : public testing::Te
     };
 
   public:
-    static void SetUpTestSuite() { barretenberg::srs::init_crs_factory("../srs_db/ignition"); }
+    static void SetUpTestSuite()
+    {
+        barretenberg::srs::init_crs_factory("../srs_db/ignition");
+        manifest_was_enabled = proof_system::honk::TranscriptManifest::enabled;
+        proof_system::honk::TranscriptManifest::enabled = true;
+    }
+
+    static void TearDownTestSuite() { proof_system::honk::TranscriptManifest::enabled = manifest_was_enabled; }
+
+    static inline bool manifest_was_enabled = false;
 
     /**
      * @brief Create inner circuit and call check_circuit on it
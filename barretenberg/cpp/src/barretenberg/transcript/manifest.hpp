@@ -78,6 +78,22 @@ class Manifest {
 
     std::vector<RoundManifest> get_round_manifests() const { return round_manifests; }
 
+    /**
+     * The number of bytes of a serialized transcript, i.e. of the elements not derived by the verifier.
+     * */
+    size_t get_proof_size() const
+    {
+        size_t proof_size = 0;
+        for (const auto& round : round_manifests) {
+            for (const auto& element : round.elements) {
+                if (!element.derived_by_verifier) {
+                    proof_size += element.num_bytes;
+                }
+            }
+        }
+        return proof_size;
+    }
+
   private:
     std::vector<RoundManifest> round_manifests;
     size_t num_rounds;
@@ -84,14 +84,7 @@ Transcript::Transcript(const std::vector<uint8_t>& input_transcript,
     const uint8_t* buffer = &input_transcript[0];
     size_t count = 0;
     // Compute how much data we need according to the manifest
-    size_t totalRequiredSize = 0;
-    for (size_t i = 0; i < num_rounds; ++i) {
-        for (auto manifest_element : input_manifest.get_round_manifest(i).elements) {
-            if (!manifest_element.derived_by_verifier) {
-                totalRequiredSize += manifest_element.num_bytes;
-            }
-        }
-    }
+    const size_t totalRequiredSize = input_manifest.get_proof_size();
     // Check that the total required size is equal to the size of the input_transcript
     if (totalRequiredSize != input_transcript.size())
         throw_or_abort(format("Serialized transcript does not contain the required number of bytes: ",
@@ -311,6 +311,15 @@ export class BarretenbergApi {
     return result[0];
   }
 
+  async acirVerifyProofs(acirComposerPtr: Ptr, proofsBuf: Uint8Array[], isRecursive: boolean): Promise<Uint8Array> {
+    const result = await this.binder.callWasmExport(
+      'acir_verify_proofs',
+      [acirComposerPtr, proofsBuf, isRecursive],
+      [BufferDeserializer()],
+    );
+    return result[0];
+  }
+
   async acirGetSolidityVerifier(acirComposerPtr: Ptr): Promise<string> {
     const result = await this.binder.callWasmExport(
       'acir_get_solidity_verifier',
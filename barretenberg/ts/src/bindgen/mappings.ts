@@ -16,6 +16,7 @@ const typeMap: { [key: string]: string } = {
   'uint8_t **': 'Uint8Array',
   in_str_buf: 'string',
   out_str_buf: 'string',
+  in_buf_vec: 'Uint8Array[]',
   in_buf32: 'Buffer32',
   out_buf32: 'Buffer32',
   'uint32_t *': 'number',
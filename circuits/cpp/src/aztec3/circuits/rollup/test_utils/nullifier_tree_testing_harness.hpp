@@ -23,6 +23,7 @@ class NullifierMemoryTreeTestingHarness : public proof_system::plonk::stdlib::me
     using MemoryTree::update_element;
 
     using NullifierMemoryTree::update_element;
+    using NullifierMemoryTree::update_elements;
 
     using NullifierMemoryTree::get_hashes;
     using NullifierMemoryTree::get_leaf;